@@ -35,11 +35,17 @@
 #include "../../ButtonToSwitch_STM32/src/ButtonToSwitch_STM32.h"
 
 //===========================>> BEGIN General use Global variables
+#ifndef MPB_BARE_METAL
 static BaseType_t errorFlag {pdFALSE};
+#endif
+static volatile uint32_t mpbCrtclNstng {0};	// Critical sections nesting level, for the bare-metal build and for the critical sections entered from an ISR
+static uint32_t mpbCrtclSvdMsk {0};	// Interrupt mask value (PRIMASK or BASEPRI) saved when entering the outermost critical section
 //===========================>> END General use Global variables
 
 //=========================================================================> Class methods delimiter
 
+uint32_t DbncdMPBttn::_sbscrptnsVer {0};
+
 DbncdMPBttn::DbncdMPBttn()
 :_mpbttnPort{NULL}, _mpbttnPin{0}, _pulledUp{true}, _typeNO{true}, _dbncTimeOrigSett{0}
 {
@@ -49,64 +55,67 @@ DbncdMPBttn::DbncdMPBttn(GPIO_TypeDef* mpbttnPort, const uint16_t &mpbttnPin, co
 : _mpbttnPort{mpbttnPort}, _mpbttnPin{mpbttnPin}, _pulledUp{pulledUp}, _typeNO{typeNO}, _dbncTimeOrigSett{dbncTimeOrigSett}
 {
 	if(_mpbttnPin != _InvalidPinNum){
-      _mpbPollTmrName = "PollMpbPin";
-      std::string mpbPinNumStr{ "00" + std::to_string(singleBitPosNum(_mpbttnPin)) };
+		char mpbPortLtr{'?'};
 
 		if(mpbttnPort == GPIOA){
-			_mpbPollTmrName += "A";
+			mpbPortLtr = 'A';
 			__HAL_RCC_GPIOA_CLK_ENABLE();	//Sets the bit in the GPIO enabled clocks register, by logic OR of the corresponding bit, no problem if already set, macro adds time to get the clk running
 		}
 		else if(mpbttnPort == GPIOB){
-			_mpbPollTmrName += "B";
+			mpbPortLtr = 'B';
 			__HAL_RCC_GPIOB_CLK_ENABLE();
 		}
 #ifdef GPIOC
 		else if(mpbttnPort == GPIOC){
-			_mpbPollTmrName += "C";
+			mpbPortLtr = 'C';
 			__HAL_RCC_GPIOC_CLK_ENABLE();
 		}
 #endif
 #ifdef GPIOD
 		else if(mpbttnPort == GPIOD){
-			_mpbPollTmrName += "D";
+			mpbPortLtr = 'D';
 			__HAL_RCC_GPIOD_CLK_ENABLE();
 		}
 #endif
 #ifdef GPIOE
 		else if(mpbttnPort == GPIOE){
-			_mpbPollTmrName += "E";
+			mpbPortLtr = 'E';
 			__HAL_RCC_GPIOE_CLK_ENABLE();
 		}
 #endif
 #ifdef GPIOF
 		else if(mpbttnPort == GPIOF){	//Port not present in all STM32 MCUs/DevBoards
-			_mpbPollTmrName += "F";
+			mpbPortLtr = 'F';
 			__HAL_RCC_GPIOF_CLK_ENABLE();
 		}
 #endif
 #ifdef GPIOG
 		else if(mpbttnPort == GPIOG){	//Port not present in all STM32 MCUs/DevBoards
-			_mpbPollTmrName += "G";
+			mpbPortLtr = 'G';
 			__HAL_RCC_GPIOG_CLK_ENABLE();
 		}
 #endif
 #ifdef GPIOH
 		else if(mpbttnPort == GPIOH){	//Port not present in all STM32 MCUs/DevBoards
-			_mpbPollTmrName += "H";
+			mpbPortLtr = 'H';
 
 			__HAL_RCC_GPIOH_CLK_ENABLE();
 		}
 #endif
 #ifdef GPIOI
 		else if(mpbttnPort == GPIOI){	//Port not present in all STM32 MCUs/DevBoards
-			_mpbPollTmrName += "I";
+			mpbPortLtr = 'I';
 			__HAL_RCC_GPIOI_CLK_ENABLE();
 }
 #endif
 
+#ifndef MPB_BARE_METAL
+		std::string mpbPinNumStr{ "00" + std::to_string(singleBitPosNum(_mpbttnPin)) };
 		mpbPinNumStr = mpbPinNumStr.substr(mpbPinNumStr.length() - 2, 2);
-
-		_mpbPollTmrName = _mpbPollTmrName + mpbPinNumStr + "_tmr";
+		_mpbPollTmrName = "PollMpbPin" + std::string(1, mpbPortLtr) + mpbPinNumStr + "_tmr";
+#else
+		(void)mpbPortLtr;	//The port letter is used only for the polling timer name
+#endif
 
 		if(_dbncTimeOrigSett < _stdMinDbncTime) 	// Best practice would impose failing the constructor (throwing an exception or building a "zombie" object)
 			_dbncTimeOrigSett = _stdMinDbncTime;	//this tolerant approach taken for developers benefit, but object will be no faithful to the instantiation parameters
@@ -121,10 +130,12 @@ DbncdMPBttn::DbncdMPBttn(GPIO_TypeDef* mpbttnPort, const uint16_t &mpbttnPin, co
 		GPIO_InitStruct.Pull = (_pulledUp == true)?GPIO_PULLUP:GPIO_PULLDOWN;
 		HAL_GPIO_Init(_mpbttnPort, &GPIO_InitStruct);
 	}
-	else{
+	else{	//No GPIO pin is configured, the object is expected to be bound to an input source, so the typeNO and debounce time parameters are kept
       _pulledUp = true;
-      _typeNO = true;
-      _dbncTimeOrigSett = 0;
+		if(_dbncTimeOrigSett < _stdMinDbncTime)
+			_dbncTimeOrigSett = _stdMinDbncTime;
+		_dbncTimeTempSett = _dbncTimeOrigSett;
+		_dbncRlsTimeTempSett = _stdMinDbncTime;
 	}
 }
 
@@ -135,16 +146,45 @@ DbncdMPBttn::DbncdMPBttn(gpioPinId_t mpbttnPinStrct, const bool &pulledUp, const
 
 DbncdMPBttn::~DbncdMPBttn() {
 
+#ifndef MPB_BARE_METAL
 	// Stop the refreshing timer:
 	end();
+#endif
 	// De-initialize the GPIOx peripheral registers to their default reset values
-	HAL_GPIO_DeInit(_mpbttnPort, _mpbttnPin);
+	if((_mpbttnPort != NULL) && (_mpbttnPin != _InvalidPinNum) && (_mpbttnPin != 0))
+		HAL_GPIO_DeInit(_mpbttnPort, _mpbttnPin);
 	// Disable the GPIOx_CLK:
 	//	__HAL_RCC_GPIOx_CLK_DISABLE ();
 	//(RCC->AHB1ENR &= ~(RCC_AHB1ENR_GPIOxEN))   //Beware, just disabling the bit corresponding to one pin
 
 }
 
+bool DbncdMPBttn::addSbscrbr(DbncdMPBttn* newSbscrbr){
+	bool result {false};
+
+	if((newSbscrbr != nullptr) && (newSbscrbr != this)){
+		mpbCrtclSctnEnter();
+		if(_sbscrbrsCnt < _MpbSbscrbrsMaxQty){
+			result = true;
+			for(uint8_t i{0}; i < _sbscrbrsCnt; ++i){
+				if(_sbscrbrsArr[i] == newSbscrbr){
+					result = false;
+					break;
+				}
+			}
+			if(result){
+				_sbscrbrsArr[_sbscrbrsCnt] = newSbscrbr;
+				++_sbscrbrsCnt;
+				++_sbscrptnsVer;
+			}
+		}
+		mpbCrtclSctnExit();
+	}
+
+	return result;
+}
+
+#ifndef MPB_BARE_METAL
 bool DbncdMPBttn::begin(const unsigned long int &pollDelayMs) {
     bool result {false};
     BaseType_t tmrModResult {pdFAIL};
@@ -168,13 +208,14 @@ bool DbncdMPBttn::begin(const unsigned long int &pollDelayMs) {
 
     return result;
 }
+#endif
 
 void DbncdMPBttn::clrStatus(bool clrIsOn){
 	/*To Resume operations after a pause() without risking generating false "Valid presses" and "On" situations,
 	several attributes must be reseted to "Start" values
 	The only important value not reseted is the _mpbFdaState, to do it call resetFda() INSTEAD of this method*/
 
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	_isPressed = false;
 	_validPressPend = false;
 	_validReleasePend = false;
@@ -183,7 +224,7 @@ void DbncdMPBttn::clrStatus(bool clrIsOn){
 	if(clrIsOn)
 		if(_isOn)
 			_turnOff();
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return;
 }
@@ -194,6 +235,16 @@ void DbncdMPBttn::clrSttChng(){
 	return;
 }
 
+void DbncdMPBttn::clrEvnts(){
+	mpbCrtclSctnEnter();
+	_evntsQCnt = 0;
+	_evntsQHead = 0;
+	_evntsOvrflw = false;
+	mpbCrtclSctnExit();
+
+	return;
+}
+
 void DbncdMPBttn::disable(){
 
     return _setIsEnabled(false);
@@ -204,6 +255,7 @@ void DbncdMPBttn::enable(){
     return _setIsEnabled(true);
 }
 
+#ifndef MPB_BARE_METAL
 bool DbncdMPBttn::end(){
 	bool result {false};
    BaseType_t tmrModResult {pdFAIL};
@@ -221,12 +273,63 @@ bool DbncdMPBttn::end(){
 
    return result;
 }
+#endif
+
+void DbncdMPBttn::flshOtptsChng(){
+	_notifyOtptsChng();
+
+	return;
+}
+
+const unsigned long int DbncdMPBttn::getClckWndw() const{
+
+	return _clckWndw;
+}
 
 const unsigned long int DbncdMPBttn::getCurDbncTime() const{
 
 	return _dbncTimeTempSett;
 }
 
+bool DbncdMPBttn::getEvnt(MpbEvnt_t &evnt){
+	bool result {false};
+
+	mpbCrtclSctnEnter();
+	if(_evntsQCnt > 0){
+		evnt = _evntsQ[_evntsQHead];
+		_evntsQHead = (_evntsQHead + 1) % _MpbEvntsQSize;
+		--_evntsQCnt;
+		result = true;
+	}
+	else{
+		evnt.evntType = evntNone;
+		evnt.evntTm = 0;
+	}
+	mpbCrtclSctnExit();
+
+	return result;
+}
+
+const uint8_t DbncdMPBttn::getEvntsCnt() const{
+
+	return _evntsQCnt;
+}
+
+const uint32_t DbncdMPBttn::getEvntsMask() const{
+
+	return _evntsMask;
+}
+
+const bool DbncdMPBttn::getEvntsOvrflw() const{
+
+	return _evntsOvrflw;
+}
+
+fncOtptsChngPtrType DbncdMPBttn::getFnWhnOtptsChng(){
+
+	return _fnWhnOtptsChng;
+}
+
 fncPtrType DbncdMPBttn::getFnWhnTrnOff(){
 
 	return _fnWhnTrnOff;
@@ -237,6 +340,16 @@ fncPtrType DbncdMPBttn::getFnWhnTrnOn(){
 	return _fnWhnTrnOn;
 }
 
+const uint16_t DbncdMPBttn::getInptIdx() const{
+
+	return _inptIdx;
+}
+
+MpbInptSrc* DbncdMPBttn::getInptSrc(){
+
+	return _inptSrc;
+}
+
 const bool DbncdMPBttn::getIsEnabled() const{
 
     return _isEnabled;
@@ -257,6 +370,11 @@ const bool DbncdMPBttn::getIsPressed() const {
 	return _isPressed;
 }
 
+const uint8_t DbncdMPBttn::getLstClckCnt() const{
+
+	return _lstClckCnt;
+}
+
 const uint32_t DbncdMPBttn::getOtptsSttsPkgd(){
 
 	return _otptsSttsPkg();
@@ -267,88 +385,129 @@ const bool DbncdMPBttn::getOutputsChange() const{
     return _outputsChange;
 }
 
+const uint16_t DbncdMPBttn::getRptCnt() const{
+
+	return _rptCnt;
+}
+
+const unsigned long int DbncdMPBttn::getRptDly() const{
+
+	return _rptDly;
+}
+
 unsigned long int DbncdMPBttn::getStrtDelay(){
 
 	return _strtDelay;
 }
 
+DbncdMPBttn* DbncdMPBttn::getSbscrbr(const uint8_t &sbscrbrIdx){
+	DbncdMPBttn* result {nullptr};
+
+	if(sbscrbrIdx < _sbscrbrsCnt)
+		result = _sbscrbrsArr[sbscrbrIdx];
+
+	return result;
+}
+
+const uint8_t DbncdMPBttn::getSbscrbrsCnt() const{
+
+	return _sbscrbrsCnt;
+}
+
+uint32_t DbncdMPBttn::getSbscrptnsVer(){
+
+	return _sbscrptnsVer;
+}
+
+#ifndef MPB_BARE_METAL
 const TaskHandle_t DbncdMPBttn::getTaskToNotify() const{
 
     return _taskToNotifyHndl;
 }
+#endif
 
+#ifndef MPB_BARE_METAL
 const TaskHandle_t DbncdMPBttn::getTaskWhileOn(){
 
 	return _taskWhileOnHndl;
 }
+#endif
 
 bool DbncdMPBttn::init(GPIO_TypeDef* mpbttnPort, const uint16_t &mpbttnPin, const bool &pulledUp, const bool &typeNO, const unsigned long int &dbncTimeOrigSett){
     bool result {false};
 
+#ifndef MPB_BARE_METAL
     if (_mpbPollTmrName == ""){
+#else
+    if (_mpbttnPort == NULL){
+#endif
+		char mpbPortLtr{'?'};
+
+		_mpbttnPort = mpbttnPort;
 		_mpbttnPin = mpbttnPin;
 		_pulledUp = pulledUp;
 		_typeNO = typeNO;
 		_dbncTimeOrigSett = dbncTimeOrigSett;
 
-      std::string mpbPollTmrName{ "PollMpbPin" };
-      std::string mpbPinNumStr{ "00" + std::to_string(singleBitPosNum(_mpbttnPin)) };
-
 
   		if(mpbttnPort == GPIOA){
-			mpbPollTmrName += "A";
+			mpbPortLtr = 'A';
   			__HAL_RCC_GPIOA_CLK_ENABLE();	//Sets the bit in the GPIO enabled clocks register, by logic OR of the corresponding bit, no problem if already set, macro adds time to get the clk running
   		}
   		else if(mpbttnPort == GPIOB){
-			mpbPollTmrName += "B";
+			mpbPortLtr = 'B';
   			__HAL_RCC_GPIOB_CLK_ENABLE();
   		}
 #ifdef GPIOC
   		else if(mpbttnPort == GPIOC){
-  			mpbPollTmrName += "C";
+  			mpbPortLtr = 'C';
   			__HAL_RCC_GPIOC_CLK_ENABLE();
   		}
 #endif
 #ifdef GPIOD
   		else if(mpbttnPort == GPIOD){
-  			mpbPollTmrName += "D";
+  			mpbPortLtr = 'D';
   			__HAL_RCC_GPIOD_CLK_ENABLE();
   		}
 #endif
 #ifdef GPIOE
   		else if(mpbttnPort == GPIOE){
-  			mpbPollTmrName += "E";
+  			mpbPortLtr = 'E';
   			__HAL_RCC_GPIOE_CLK_ENABLE();
   		}
 #endif
 #ifdef GPIOF
   		else if(mpbttnPort == GPIOF){	//Port not present in all STM32 MCUs/DevBoards
-  			mpbPollTmrName += "F";
+  			mpbPortLtr = 'F';
   			__HAL_RCC_GPIOF_CLK_ENABLE();
   		}
 #endif
 #ifdef GPIOG
   		else if(mpbttnPort == GPIOG){	//Port not present in all STM32 MCUs/DevBoards
-  			mpbPollTmrName += "G";
+  			mpbPortLtr = 'G';
   			__HAL_RCC_GPIOG_CLK_ENABLE();
   		}
 #endif
 #ifdef GPIOH
   		else if(mpbttnPort == GPIOH){	//Port not present in all STM32 MCUs/DevBoards
-  			mpbPollTmrName += "H";
+  			mpbPortLtr = 'H';
   			__HAL_RCC_GPIOH_CLK_ENABLE();
   		}
 #endif
 #ifdef GPIOI
   		else if(mpbttnPort == GPIOI){	//Port not present in all STM32 MCUs/DevBoards
-  			mpbPollTmrName += "I";
+  			mpbPortLtr = 'I';
   			__HAL_RCC_GPIOI_CLK_ENABLE();
   }
 #endif
 
+#ifndef MPB_BARE_METAL
+		std::string mpbPinNumStr{ "00" + std::to_string(singleBitPosNum(_mpbttnPin)) };
 		mpbPinNumStr = mpbPinNumStr.substr(mpbPinNumStr.length() - 2, 2);
-
-		_mpbPollTmrName = _mpbPollTmrName + mpbPinNumStr + "_tmr";
+		_mpbPollTmrName = "PollMpbPin" + std::string(1, mpbPortLtr) + mpbPinNumStr + "_tmr";
+#else
+		(void)mpbPortLtr;	//The port letter is used only for the polling timer name
+#endif
 
         if(_dbncTimeOrigSett < _stdMinDbncTime) 	// Best practice would impose failing the constructor (throwing an exeption or building a "zombie" object)
             _dbncTimeOrigSett = _stdMinDbncTime;    //this tolerant approach taken for developers benefit, but object will be no faithful to the instantiation parameters
@@ -372,32 +531,51 @@ bool DbncdMPBttn::init(gpioPinId_t mpbttnPinStrct, const bool &pulledUp, const b
 	return init(mpbttnPinStrct.portId, mpbttnPinStrct.pinNum, pulledUp, typeNO, dbncTimeOrigSett);
 }
 
+#ifndef MPB_BARE_METAL
 void DbncdMPBttn::mpbPollCallback(TimerHandle_t mpbTmrCbArg){
 	DbncdMPBttn* mpbObj = (DbncdMPBttn*)pvTimerGetTimerID(mpbTmrCbArg);
+
+	mpbObj->update(xTaskGetTickCount() / portTICK_RATE_MS);
+
+	return;
+}
+#endif
+
+void DbncdMPBttn::_notifyOtptsChng(){
+#ifndef MPB_BARE_METAL
 	BaseType_t xReturned;
+#endif
 
-	taskENTER_CRITICAL();
-	if(mpbObj->getIsEnabled()){
-		// Input/Output signals update
-		mpbObj->updIsPressed();
-		// Flags/Triggers calculation & update
-		mpbObj->updValidPressesStatus();
-	}
-	// State machine status update
-	mpbObj->updFdaState();
-	taskEXIT_CRITICAL();
-
-	if (mpbObj->getOutputsChange()){	//Output changes might happen as part of the updFdaState() execution
-		if(mpbObj->getTaskToNotify() != NULL){
-			xReturned = xTaskNotify(
-					mpbObj->getTaskToNotify(),	//TaskHandle_t of the task receiving notification
-					static_cast<unsigned long>(mpbObj->getOtptsSttsPkgd()),
-					eSetValueWithOverwrite	//In this specific case using eSetBits is also a valid option
-					);
+	if (_outputsChange){	//Output changes might happen as part of the updFdaState() execution
+		if(_fnWhnOtptsChng != nullptr){
+			_fnWhnOtptsChng(getOtptsSttsPkgd());
+			setOutputsChange(false);
+		}
+#ifndef MPB_BARE_METAL
+		if(_taskToNotifyHndl != NULL){
+			if(xPortIsInsideInterrupt()){	//Polling from a hardware timer ISR, the ISR safe API version must be used
+				BaseType_t xHigherPriorityTaskWoken {pdFALSE};
+
+				xReturned = xTaskNotifyFromISR(
+						_taskToNotifyHndl,
+						static_cast<unsigned long>(getOtptsSttsPkgd()),
+						eSetValueWithOverwrite,
+						&xHigherPriorityTaskWoken
+						);
+				portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+			}
+			else{
+				xReturned = xTaskNotify(
+						_taskToNotifyHndl,	//TaskHandle_t of the task receiving notification
+						static_cast<unsigned long>(getOtptsSttsPkgd()),
+						eSetValueWithOverwrite	//In this specific case using eSetBits is also a valid option
+						);
+			}
 			 if (xReturned != pdPASS)
 				 errorFlag = pdTRUE;
-			 mpbObj->setOutputsChange(false);	//If the outputsChange triggers a task to treat it, here's the flag reset, in other cases the mechanism reading the changes must take care of the flag status
+			 setOutputsChange(false);	//If the outputsChange triggers a task to treat it, here's the flag reset, in other cases the mechanism reading the changes must take care of the flag status
 		}
+#endif
 	}
 
 	return;
@@ -412,10 +590,15 @@ uint32_t DbncdMPBttn::_otptsSttsPkg(uint32_t prevVal){
 		prevVal |= ((uint32_t)1) << IsEnabledBitPos;
 	else
 		prevVal &= ~(((uint32_t)1) << IsEnabledBitPos);
+	if(_evntsQCnt > 0)
+		prevVal |= ((uint32_t)1) << EvntPendBitPos;
+	else
+		prevVal &= ~(((uint32_t)1) << EvntPendBitPos);
 
 	return prevVal;
 }
 
+#ifndef MPB_BARE_METAL
 bool DbncdMPBttn::pause(){
     bool result {false};
     BaseType_t tmrModResult {pdFAIL};
@@ -433,6 +616,88 @@ bool DbncdMPBttn::pause(){
 
     return result;
 }
+#endif
+
+void DbncdMPBttn::_pblshIsOn(){
+	bool curIsOn {_isOn};
+
+	for(uint8_t i{0}; i < _sbscrbrsCnt; ++i)
+		_sbscrbrsArr[i]->_rcvPblshrChng(this, curIsOn);
+
+	return;
+}
+
+void DbncdMPBttn::_pushEvnt(const MpbEvntType_t &evntType, const unsigned long int &evntTm){
+	if(_evntsMask & (((uint32_t)1) << evntType)){
+		mpbCrtclSctnEnter();
+		if(_evntsQCnt < _MpbEvntsQSize){
+			_evntsQ[(_evntsQHead + _evntsQCnt) % _MpbEvntsQSize] = {evntType, evntTm};
+			++_evntsQCnt;
+			_outputsChange = true;	//The notification mechanism is used to let the consumer know there are events to be read
+		}
+		else{
+			_evntsOvrflw = true;
+		}
+		mpbCrtclSctnExit();
+	}
+
+	return;
+}
+
+void DbncdMPBttn::_rcvPblshrChng(DbncdMPBttn* pblshr, const bool &pblshrIsOn){
+	//The base class has no dependencies on other objects, the subclasses depending on other objects' state must override this method
+	(void)pblshr;
+	(void)pblshrIsOn;
+
+	return;
+}
+
+bool DbncdMPBttn::_rdPrssSt(){
+	/*To be 'pressed' the conditions are:
+   1) For NO == true
+   	a) _pulledUp == false ==> digitalRead == HIGH
+	  	b) _pulledUp == true ==> digitalRead == LOW
+   2) For NO == false
+   	a) _pulledUp == false ==> digitalRead == LOW
+      b) _pulledUp == true ==> digitalRead == HIGH
+    */
+	bool result {false};
+   bool tmpPinLvlSet {false};
+
+	if(_inptSrc != nullptr){
+		//The input source provides the contact active state, pressed for NO MPBs, released for NC MPBs
+		result = (_inptSrc->getInptSt(_inptIdx) == _typeNO);
+	}
+	else if((_mpbttnPort != NULL) && (_mpbttnPin != _InvalidPinNum)){
+	   if(HAL_GPIO_ReadPin(_mpbttnPort, _mpbttnPin) == GPIO_PIN_SET)
+	   	tmpPinLvlSet = true;
+
+	   if (_typeNO == true){
+	   	//For NO MPBs
+	      if (_pulledUp == false){
+	      	if (tmpPinLvlSet == true)
+	      		result = true;
+	      }
+	      else{
+	      	if (tmpPinLvlSet == false)
+	      		result = true;
+	      }
+	   }
+	   else{
+	   	//For NC MPBs
+			if (_pulledUp == false){
+				if (tmpPinLvlSet == false)
+					result = true;
+			}
+	      else{
+	      	if (tmpPinLvlSet == true)
+	      		result = true;
+	      }
+	   }
+	}
+
+   return result;
+}
 
 void DbncdMPBttn::resetDbncTime(){
 	setDbncTime(_dbncTimeOrigSett);
@@ -441,15 +706,19 @@ void DbncdMPBttn::resetDbncTime(){
 }
 
 void DbncdMPBttn::resetFda(){
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	clrStatus(true);
+	_clckCnt = 0;	//Any click sequence in progress is discarded
+	_clckHld = _prssRlsCcl;
+	_clckPrssd = _prssRlsCcl;
 	setSttChng();
 	_mpbFdaState = stOffNotVPP;
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return;
 }
 
+#ifndef MPB_BARE_METAL
 bool DbncdMPBttn::resume(){
 	bool result {false};
 	BaseType_t tmrModResult {pdFAIL};
@@ -466,42 +735,111 @@ bool DbncdMPBttn::resume(){
 
 	return result;
 }
+#endif
+
+bool DbncdMPBttn::rmvSbscrbr(DbncdMPBttn* sbscrbr){
+	bool result {false};
+
+	mpbCrtclSctnEnter();
+	for(uint8_t i{0}; i < _sbscrbrsCnt; ++i){
+		if(_sbscrbrsArr[i] == sbscrbr){
+			for(uint8_t j{i}; j < (_sbscrbrsCnt - 1); ++j)
+				_sbscrbrsArr[j] = _sbscrbrsArr[j + 1];
+			--_sbscrbrsCnt;
+			_sbscrbrsArr[_sbscrbrsCnt] = nullptr;
+			++_sbscrptnsVer;
+			result = true;
+			break;
+		}
+	}
+	mpbCrtclSctnExit();
+
+	return result;
+}
+
+void DbncdMPBttn::setClckWndw(const unsigned long int &newVal){
+	mpbCrtclSctnEnter();
+	if(_clckWndw != newVal){
+		_clckWndw = newVal;
+		_clckCnt = 0;
+		_clckHld = _prssRlsCcl;	//A press in progress when the detection is enabled is not counted as a click
+		_clckPrssd = _prssRlsCcl;
+	}
+	mpbCrtclSctnExit();
+
+	return;
+}
 
 bool DbncdMPBttn::setDbncTime(const unsigned long int &newDbncTime){
     bool result {true};
 
-    taskENTER_CRITICAL();
+    mpbCrtclSctnEnter();
     if(_dbncTimeTempSett != newDbncTime){
 		 if (newDbncTime >= _stdMinDbncTime)
 			  _dbncTimeTempSett = newDbncTime;
 		 else
 			  result = false;
     }
-    taskEXIT_CRITICAL();
+    mpbCrtclSctnExit();
 
     return result;
 }
 
+void DbncdMPBttn::setEvntsMask(const uint32_t &newEvntsMask){
+	mpbCrtclSctnEnter();
+	if(_evntsMask != newEvntsMask)
+		_evntsMask = newEvntsMask;
+	mpbCrtclSctnExit();
+
+	return;
+}
+
+void DbncdMPBttn::setFnWhnOtptsChngPtr(void (*newFnWhnOtptsChng)(uint32_t)){
+	mpbCrtclSctnEnter();
+	if (_fnWhnOtptsChng != newFnWhnOtptsChng)
+		_fnWhnOtptsChng = newFnWhnOtptsChng;
+	mpbCrtclSctnExit();
+
+	return;
+}
+
 void DbncdMPBttn::setFnWhnTrnOffPtr(void (*newFnWhnTrnOff)()){
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	if (_fnWhnTrnOff != newFnWhnTrnOff)
 		_fnWhnTrnOff = newFnWhnTrnOff;
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return;
 }
 
 void DbncdMPBttn::setFnWhnTrnOnPtr(void (*newFnWhnTrnOn)()){
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	if (_fnWhnTrnOn != newFnWhnTrnOn)
 		_fnWhnTrnOn = newFnWhnTrnOn;
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return;
 }
 
+bool DbncdMPBttn::setInptSrc(MpbInptSrc* newInptSrc, const uint16_t &newInptIdx){
+	bool result {true};
+
+	if((newInptSrc != nullptr) && (newInptIdx >= newInptSrc->getInptsCnt()))
+		result = false;
+	if(result){
+		mpbCrtclSctnEnter();
+		if(_inptSrc != newInptSrc)
+			_inptSrc = newInptSrc;
+		if(_inptIdx != newInptIdx)
+			_inptIdx = newInptIdx;
+		mpbCrtclSctnExit();
+	}
+
+	return result;
+}
+
 void DbncdMPBttn::_setIsEnabled(const bool &newEnabledValue){
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	if(_isEnabled != newEnabledValue){
 		if (newEnabledValue){  //Change to Enabled = true
 			_validEnablePend = true;
@@ -514,13 +852,13 @@ void DbncdMPBttn::_setIsEnabled(const bool &newEnabledValue){
 				_validEnablePend = false;
 		}
 	}
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return;
 }
 
 void DbncdMPBttn::setIsOnDisabled(const bool &newIsOnDisabled){
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	if(_isOnDisabled != newIsOnDisabled){
 		_isOnDisabled = newIsOnDisabled;
 		if(!_isEnabled){
@@ -532,16 +870,16 @@ void DbncdMPBttn::setIsOnDisabled(const bool &newIsOnDisabled){
 			}
 		}
 	}
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return;
 }
 
 void DbncdMPBttn::setOutputsChange(bool newOutputsChange){
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	if(_outputsChange != newOutputsChange)
    	_outputsChange = newOutputsChange;
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
    return;
 }
@@ -552,10 +890,11 @@ void DbncdMPBttn::setSttChng(){
 	return;
 }
 
+#ifndef MPB_BARE_METAL
 void DbncdMPBttn::setTaskToNotify(const TaskHandle_t &newTaskHandle){
 	eTaskState taskWhileOnStts{};
 
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	if(_taskToNotifyHndl != newTaskHandle){
 		if(_taskToNotifyHndl != NULL){
 			taskWhileOnStts = eTaskGetState(_taskToNotifyHndl);
@@ -569,15 +908,17 @@ void DbncdMPBttn::setTaskToNotify(const TaskHandle_t &newTaskHandle){
 		if (newTaskHandle != NULL)
 			_taskToNotifyHndl = newTaskHandle;
 	}
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return;
 }
+#endif
 
+#ifndef MPB_BARE_METAL
 void DbncdMPBttn::setTaskWhileOn(const TaskHandle_t &newTaskHandle){
 	eTaskState taskWhileOnStts{};
 
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	if(_taskWhileOnHndl != newTaskHandle){
 		if(_taskWhileOnHndl != NULL){
 			taskWhileOnStts = eTaskGetState(_taskWhileOnHndl);
@@ -591,61 +932,158 @@ void DbncdMPBttn::setTaskWhileOn(const TaskHandle_t &newTaskHandle){
 		if (newTaskHandle != NULL)
 			_taskWhileOnHndl = newTaskHandle;
 	}
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return;
 }
+#endif
 
 void DbncdMPBttn::_turnOff(){
 	if(_isOn){
-		//---------------->> Tasks related actions
-		if(_taskWhileOnHndl != NULL){
+#ifndef MPB_BARE_METAL
+		//---------------->> Tasks related actions. Not available when updated from an ISR, as the tasks suspending API has no ISR safe version
+		if((_taskWhileOnHndl != NULL) && !xPortIsInsideInterrupt()){
 			eTaskState taskWhileOnStts{eTaskGetState(_taskWhileOnHndl)};
 			if (taskWhileOnStts != eSuspended)
 				if(taskWhileOnStts != eDeleted)
 					vTaskSuspend(_taskWhileOnHndl);
 		}
+#endif
 		//---------------->> Functions related actions
 		if(_fnWhnTrnOff != nullptr)
 			_fnWhnTrnOff();
 	}
 	//---------------->> Flags related actions. The attribute flag is re-tested in case the tasks of functions actions reseted it's value to avoid flag related actions to be executed
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	if(_isOn){
 		_isOn = false;
 		_outputsChange = true;
+		_pushEvnt(evntOff, _curPollTm);
+		_pblshIsOn();
 	}
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return;
 }
 
 void DbncdMPBttn::_turnOn(){
 	if(!_isOn){
-		//---------------->> Tasks related actions
-		if(_taskWhileOnHndl != NULL){
+#ifndef MPB_BARE_METAL
+		//---------------->> Tasks related actions. Not available when updated from an ISR, as the tasks suspending API has no ISR safe version
+		if((_taskWhileOnHndl != NULL) && !xPortIsInsideInterrupt()){
 			eTaskState taskWhileOnStts{eTaskGetState(_taskWhileOnHndl)};
 			if(taskWhileOnStts != eDeleted)
 				if (taskWhileOnStts == eSuspended)
 					vTaskResume(_taskWhileOnHndl);
 		}
+#endif
 		//---------------->> Functions related actions
 		if(_fnWhnTrnOn != nullptr)
 			_fnWhnTrnOn();
 	}
 	//---------------->> Flags related actions. The attribute flag is re-tested in case the tasks of functions actions reseted it's value to avoid flag related actions to be executed
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	if(!_isOn){
 		_isOn = true;
 		_outputsChange = true;
+		_pushEvnt(evntOn, _curPollTm);
+		_pblshIsOn();
+	}
+	mpbCrtclSctnExit();
+
+	return;
+}
+
+void DbncdMPBttn::update(const unsigned long int &curTm, const bool &dfrNtf){
+	mpbCrtclSctnEnter();
+	_curPollTm = curTm;
+	if(_isEnabled){
+		// Input/Output signals update
+		updIsPressed();
+		// Flags/Triggers calculation & update
+		updPollFlags();
+		if(_clckWndw > 0)
+			_updClcks();
+		if(_rptDly > 0)
+			_updRpt();
+	}
+	// State machine status update
+	updFdaState();
+	mpbCrtclSctnExit();
+
+	if(!dfrNtf)
+		_notifyOtptsChng();
+
+	return;
+}
+
+void DbncdMPBttn::_updClcks(){
+	//The valid presses and releases are detected as the edges of the press-release cycle flag, common to all the classes
+	MpbEvntType_t clckEvnt {evntNone};
+
+	if(_prssRlsCcl != _clckPrssd){
+		_clckPrssd = _prssRlsCcl;
+		if(!_clckPrssd){	//Valid release
+			if(!_clckHld){
+				if(_clckCnt < 0xFF)
+					++_clckCnt;
+			}
+			else{
+				_clckHld = false;
+			}
+		}
+		_clckWndwStrt = _curPollTm;	//The single time stamp used for the press duration and for the time between clicks
+	}
+	else if(_clckPrssd){
+		if(!_clckHld && ((_curPollTm - _clckWndwStrt) >= _clckWndw)){	//The press became a hold, the sequence is discarded
+			_clckHld = true;
+			_clckCnt = 0;
+		}
+	}
+	else if((_clckCnt > 0) && ((_curPollTm - _clckWndwStrt) >= _clckWndw)){	//No new press in the window, the sequence is completed
+		_lstClckCnt = _clckCnt;
+		_clckCnt = 0;
+		if(_lstClckCnt == 1)
+			clckEvnt = evntSnglClck;
+		else if(_lstClckCnt == 2)
+			clckEvnt = evntDblClck;
+		else if(_lstClckCnt == 3)
+			clckEvnt = evntTrplClck;
+		else
+			clckEvnt = evntMltClck;
+		_pushEvnt(clckEvnt, _clckWndwStrt);
+	}
+
+	return;
+}
+
+void DbncdMPBttn::_updRpt(){
+	if(_prssRlsCcl != _rptPrssd){
+		_rptPrssd = _prssRlsCcl;
+		if(_rptPrssd){	//Valid press, the repeats schedule is calculated from the poll that accepted it, as not every subclass keeps the debounce timer start
+			_rptCnt = 0;
+			_rptCurPrd = _rptPrdStrt;
+			_rptNxtTm = _curPollTm + _rptDly;
+		}
+	}
+	if(_rptPrssd && ((long)(_curPollTm - _rptNxtTm) >= 0)){
+		if(_rptCnt < 0xFFFF)
+			++_rptCnt;
+		_pushEvnt(evntRpt, _rptNxtTm);
+		_rptNxtTm += _rptCurPrd;
+		if(_rptCurPrd > (_rptPrdMin + _rptAcclStp))
+			_rptCurPrd -= _rptAcclStp;
+		else
+			_rptCurPrd = _rptPrdMin;
+		if((long)(_curPollTm - _rptNxtTm) >= 0)	//Polls delayed by more than a period, the missed repeats are not back-filled, the schedule restarts from the current poll
+			_rptNxtTm = _curPollTm + _rptCurPrd;
 	}
-	taskEXIT_CRITICAL();
 
 	return;
 }
 
 void DbncdMPBttn::updFdaState(){
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	switch(_mpbFdaState){
 		case stOffNotVPP:
 			//In: >>---------------------------------->>
@@ -744,51 +1182,21 @@ void DbncdMPBttn::updFdaState(){
 	default:
 		break;
 	}
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return;
 }
 
 bool DbncdMPBttn::updIsPressed(){
-	/*To be 'pressed' the conditions are:
-   1) For NO == true
-   	a) _pulledUp == false ==> digitalRead == HIGH
-	  	b) _pulledUp == true ==> digitalRead == LOW
-   2) For NO == false
-   	a) _pulledUp == false ==> digitalRead == LOW
-      b) _pulledUp == true ==> digitalRead == HIGH
-    */
-	bool result {false};
-   bool tmpPinLvlSet {false};
+	_isPressed = _rdPrssSt();
 
-   if(HAL_GPIO_ReadPin(_mpbttnPort, _mpbttnPin) == GPIO_PIN_SET)
-   	tmpPinLvlSet = true;
+	return _isPressed;
+}
 
-   if (_typeNO == true){
-   	//For NO MPBs
-      if (_pulledUp == false){
-      	if (tmpPinLvlSet == true)
-      		result = true;
-      }
-      else{
-      	if (tmpPinLvlSet == false)
-      		result = true;
-      }
-   }
-   else{
-   	//For NC MPBs
-		if (_pulledUp == false){
-			if (tmpPinLvlSet == false)
-				result = true;
-		}
-      else{
-      	if (tmpPinLvlSet == true)
-      		result = true;
-      }
-   }
-   _isPressed = result;
+void DbncdMPBttn::updPollFlags(){
+	updValidPressesStatus();
 
-   return _isPressed;
+	return;
 }
 
 bool DbncdMPBttn::updValidPressesStatus(){
@@ -797,13 +1205,14 @@ bool DbncdMPBttn::updValidPressesStatus(){
 			_dbncRlsTimerStrt = 0;
 		if(!_prssRlsCcl){
 			if(_dbncTimerStrt == 0){    //This is the first detection of the press event
-				_dbncTimerStrt = xTaskGetTickCount() / portTICK_RATE_MS;	//Started to be pressed
+				_dbncTimerStrt = _curPollTm;	//Started to be pressed
 			}
 			else{
-				if (((xTaskGetTickCount() / portTICK_RATE_MS) - _dbncTimerStrt) >= (_dbncTimeTempSett + _strtDelay)){
+				if ((_curPollTm - _dbncTimerStrt) >= (_dbncTimeTempSett + _strtDelay)){
 					_validPressPend = true;
 					_validReleasePend = false;
 					_prssRlsCcl = true;
+					_pushEvnt(evntVldPrss, _dbncTimerStrt);
 				}
 			}
 		}
@@ -813,12 +1222,13 @@ bool DbncdMPBttn::updValidPressesStatus(){
 			_dbncTimerStrt = 0;
 		if(_prssRlsCcl){
 			if(_dbncRlsTimerStrt == 0){    //This is the first detection of the release event
-				_dbncRlsTimerStrt = xTaskGetTickCount() / portTICK_RATE_MS;	//Started to be UNpressed
+				_dbncRlsTimerStrt = _curPollTm;	//Started to be UNpressed
 			}
 			else{
-				if (((xTaskGetTickCount() / portTICK_RATE_MS) - _dbncRlsTimerStrt) >= (_dbncRlsTimeTempSett)){
+				if ((_curPollTm - _dbncRlsTimerStrt) >= (_dbncRlsTimeTempSett)){
 					_validReleasePend = true;
 					_prssRlsCcl = false;
+					_pushEvnt(evntVldRls, _dbncRlsTimerStrt);
 				}
 			}
 		}
@@ -860,11 +1270,31 @@ bool DbncdDlydMPBttn::init(gpioPinId_t mpbttnPinStrct, const bool &pulledUp, con
 	return init(mpbttnPinStrct.portId, mpbttnPinStrct.pinNum, pulledUp, typeNO, dbncTimeOrigSett, strtDelay);
 }
 
+bool DbncdDlydMPBttn::setRpt(const unsigned long int &rptDly, const unsigned long int &rptPrdStrt, const unsigned long int &rptPrdMin, const unsigned long int &rptAcclStp){
+	bool result {false};
+
+	if((rptDly == 0) || ((rptPrdStrt > 0) && (rptPrdMin <= rptPrdStrt))){
+		mpbCrtclSctnEnter();
+		_rptDly = rptDly;
+		_rptPrdStrt = rptPrdStrt;
+		_rptPrdMin = (rptPrdMin == 0)?rptPrdStrt:rptPrdMin;
+		_rptAcclStp = rptAcclStp;
+		_rptPrssd = _prssRlsCcl;	//A press in progress is scheduled from the last poll, no repeat missed with the previous settings is generated
+		_rptCnt = 0;
+		_rptCurPrd = _rptPrdStrt;
+		_rptNxtTm = _curPollTm + _rptDly;
+		mpbCrtclSctnExit();
+		result = true;
+	}
+
+	return result;
+}
+
 void DbncdDlydMPBttn::setStrtDelay(const unsigned long int &newStrtDelay){
-   taskENTER_CRITICAL();
+   mpbCrtclSctnEnter();
 	if(_strtDelay != newStrtDelay)
 		_strtDelay = newStrtDelay;
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return;
 }
@@ -881,6 +1311,7 @@ LtchMPBttn::LtchMPBttn(gpioPinId_t mpbttnPinStrct, const bool &pulledUp, const b
 {
 }
 
+#ifndef MPB_BARE_METAL
 bool LtchMPBttn::begin(const unsigned long int &pollDelayMs){
    bool result {false};
    BaseType_t tmrModResult {pdFAIL};
@@ -904,14 +1335,18 @@ bool LtchMPBttn::begin(const unsigned long int &pollDelayMs){
 
 	return result;
 }
+#endif
 
 void LtchMPBttn::clrStatus(bool clrIsOn){
-	taskENTER_CRITICAL();
-	_isLatched = false;
+	mpbCrtclSctnEnter();
+	if(_isLatched){
+		_isLatched = false;
+		_pushEvnt(evntUnltchd, _curPollTm);
+	}
 	_validUnlatchPend = false;
 	_validUnlatchRlsPend = false;
 	DbncdMPBttn::clrStatus(clrIsOn);
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return;
 }
@@ -931,60 +1366,42 @@ const bool LtchMPBttn::getUnlatchPend() const{
 	return _validUnlatchPend;
 }
 
-void LtchMPBttn::mpbPollCallback(TimerHandle_t mpbTmrCbArg){
-    LtchMPBttn* mpbObj = (LtchMPBttn*)pvTimerGetTimerID(mpbTmrCbArg);
-    BaseType_t xReturned;
-
-    taskENTER_CRITICAL();
-    if(mpbObj->getIsEnabled()){
-		// Input/Output signals update
-		mpbObj->updIsPressed();
-		// Flags/Triggers calculation & update
-		mpbObj->updValidPressesStatus();
-		mpbObj->updValidUnlatchStatus();
- 	}
-	// State machine state update
-	mpbObj->updFdaState();
-	taskEXIT_CRITICAL();
-
-	//Outputs update based on outputsChange flag
-	if (mpbObj->getOutputsChange()){
-		if(mpbObj->getTaskToNotify() != NULL){
-			xReturned = xTaskNotify(
-					mpbObj->getTaskToNotify(),	//TaskHandle_t of the task receiving notification
-					static_cast<unsigned long>(mpbObj->getOtptsSttsPkgd()),
-					eSetValueWithOverwrite
-			);
-			if (xReturned != pdPASS)
-				errorFlag = pdTRUE;
-			mpbObj->setOutputsChange(false);
-		}
+void LtchMPBttn::resetFda(){
+	mpbCrtclSctnEnter();
+	if(_isLatched){
+		_isLatched = false;
+		_pushEvnt(evntUnltchd, _curPollTm);
 	}
+	_validUnlatchPend = false;
+	_validUnlatchRlsPend = false;
+	DbncdMPBttn::resetFda();	//Clears the common flags, timers and click sequence, and sets the state change flag
+	_mpbFdaState = stOffNotVPP;	//The latching state machine state, the LtchMPBttn attribute hides the DbncdMPBttn one
+	mpbCrtclSctnExit();
 
 	return;
 }
 
 void LtchMPBttn::setTrnOffASAP(const bool &newVal){
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	if(_trnOffASAP != newVal)
 		_trnOffASAP = newVal;
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 }
 
 void LtchMPBttn::setUnlatchPend(const bool &newVal){
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	if(_validUnlatchPend != newVal)
 		_validUnlatchPend = newVal;
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return;
 }
 
 void LtchMPBttn::setUnlatchRlsPend(const bool &newVal){
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	if(_validUnlatchRlsPend != newVal)
 		_validUnlatchRlsPend = newVal;
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return;
 }
@@ -992,19 +1409,19 @@ void LtchMPBttn::setUnlatchRlsPend(const bool &newVal){
 bool LtchMPBttn::unlatch(){
 	bool result{false};
 
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	if(_isLatched){
 		setUnlatchPend(true);
 		setUnlatchRlsPend(true);
 		result = true;
 	}
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return result;
 }
 
 void LtchMPBttn::updFdaState(){
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	switch(_mpbFdaState){
 		case stOffNotVPP:
 			//In: >>---------------------------------->>
@@ -1066,8 +1483,10 @@ void LtchMPBttn::updFdaState(){
 			if(_sttChng){clrSttChng();}	// Execute this code only ONCE, when entering this state
 			//Do: >>---------------------------------->>
 			_validReleasePend = false;
-			if(!_isLatched)
+			if(!_isLatched){
 				_isLatched = true;
+				_pushEvnt(evntLtchd, _curPollTm);
+			}
 			_mpbFdaState = stLtchNVUP;
 			setSttChng();
 			//Out: >>---------------------------------->>
@@ -1136,8 +1555,10 @@ void LtchMPBttn::updFdaState(){
 			_validUnlatchRlsPend = false;
 			if(_isOn)
 				_turnOff();
-			if(_isLatched)
+			if(_isLatched){
 				_isLatched = false;
+				_pushEvnt(evntUnltchd, _curPollTm);
+			}
 			if(_validPressPend)
 				_validPressPend = false;
 			if(_validReleasePend)
@@ -1189,7 +1610,14 @@ void LtchMPBttn::updFdaState(){
 	default:
 		break;
 	}
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
+
+	return;
+}
+
+void LtchMPBttn::updPollFlags(){
+	updValidPressesStatus();
+	updValidUnlatchStatus();
 
 	return;
 }
@@ -1219,7 +1647,7 @@ void TgglLtchMPBttn::stOffNVURP_Do(){
 }
 
 void TgglLtchMPBttn::updValidUnlatchStatus(){
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	if(_isLatched){
 		if(_validPressPend){
 			_validUnlatchPend = true;
@@ -1230,7 +1658,7 @@ void TgglLtchMPBttn::updValidUnlatchStatus(){
 			_validReleasePend = false;
 		}
 	}
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return;
 }
@@ -1250,10 +1678,10 @@ TmLtchMPBttn::TmLtchMPBttn(gpioPinId_t mpbttnPinStrct, const unsigned long int &
 }
 
 void TmLtchMPBttn::clrStatus(bool clrIsOn){
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	_srvcTimerStrt = 0;
 	LtchMPBttn::clrStatus(clrIsOn);
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return;
 }
@@ -1266,23 +1694,23 @@ const unsigned long int TmLtchMPBttn::getSrvcTime() const{
 bool TmLtchMPBttn::setSrvcTime(const unsigned long int &newSrvcTime){
 	bool result {true};
 
-   taskENTER_CRITICAL();
+   mpbCrtclSctnEnter();
 	if (_srvcTime != newSrvcTime){
 		if (newSrvcTime >= _MinSrvcTime)  //The minimum activation time is _minActTime milliseconds
 			_srvcTime = newSrvcTime;
 		else
 			result = false;
    }
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
    return result;
 }
 
 void TmLtchMPBttn::setTmerRstbl(const bool &newIsRstbl){
-   taskENTER_CRITICAL();
+   mpbCrtclSctnEnter();
 	if(_tmRstbl != newIsRstbl)
         _tmRstbl = newIsRstbl;
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
     return;
 }
@@ -1295,7 +1723,7 @@ void TmLtchMPBttn::stOffNotVPP_Out(){
 
 void TmLtchMPBttn::stOffVPP_Out(){
 	//This method is invoked exclusively from the updFdaState, no need to declare it critical section
-	_srvcTimerStrt = xTaskGetTickCount() / portTICK_RATE_MS;
+	_srvcTimerStrt = _curPollTm;
 
 	return;
 }
@@ -1304,10 +1732,10 @@ void TmLtchMPBttn::updValidUnlatchStatus(){
 	if(_isLatched){
 		if(_validPressPend){
 			if(_tmRstbl)
-				_srvcTimerStrt = xTaskGetTickCount() / portTICK_RATE_MS;
+				_srvcTimerStrt = _curPollTm;
 			_validPressPend = false;
 		}
-		if (((xTaskGetTickCount() / portTICK_RATE_MS) - _srvcTimerStrt) >= _srvcTime){
+		if ((_curPollTm - _srvcTimerStrt) >= _srvcTime){
 			_validUnlatchPend = true;
 			_validUnlatchRlsPend = true;
 		}
@@ -1329,6 +1757,7 @@ HntdTmLtchMPBttn::HntdTmLtchMPBttn(gpioPinId_t mpbttnPinStrct, const unsigned lo
 {
 }
 
+#ifndef MPB_BARE_METAL
 bool HntdTmLtchMPBttn::begin(const unsigned long int &pollDelayMs){
    bool result {false};
    BaseType_t tmrModResult {pdFAIL};
@@ -1352,10 +1781,11 @@ bool HntdTmLtchMPBttn::begin(const unsigned long int &pollDelayMs){
 
    return result;
 }
+#endif
 
 void HntdTmLtchMPBttn::clrStatus(bool clrIsOn){
 //	Put here class specific sets/resets, including pilot and warning
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	_validWrnngSetPend = false;
 	_validWrnngResetPend = false;
 	_wrnngOn = false; // Direct attribute flag unusual manipulation to avoid triggering Tasks and Functions responses
@@ -1366,7 +1796,7 @@ void HntdTmLtchMPBttn::clrStatus(bool clrIsOn){
 	else
 		_pilotOn = false; // Direct attribute flag unusual manipulation to avoid triggering Tasks and Functions responses
 	TmLtchMPBttn::clrStatus(clrIsOn);
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return;
 }
@@ -1401,40 +1831,6 @@ const bool HntdTmLtchMPBttn::getWrnngOn() const{
     return _wrnngOn;
 }
 
-void HntdTmLtchMPBttn::mpbPollCallback(TimerHandle_t mpbTmrCbArg){
-	HntdTmLtchMPBttn* mpbObj = (HntdTmLtchMPBttn*)pvTimerGetTimerID(mpbTmrCbArg);
-	BaseType_t xReturned;
-
-	taskENTER_CRITICAL();
-	if(mpbObj->getIsEnabled()){
-		// Input/Output signals update
-		mpbObj->updIsPressed();
-		// Flags/Triggers calculation & update
-		mpbObj->updValidPressesStatus();
-		mpbObj->updValidUnlatchStatus();
-		mpbObj->updWrnngOn();
-		mpbObj->updPilotOn();
-	}
- 	// State machine state update
- 	mpbObj->updFdaState();
- 	taskEXIT_CRITICAL();
-
-	if (mpbObj->getOutputsChange()){
-		if(mpbObj->getTaskToNotify() != NULL){
-			xReturned = xTaskNotify(
-					mpbObj->getTaskToNotify(),	//TaskHandle_t of the task receiving notification
-					static_cast<unsigned long>(mpbObj->getOtptsSttsPkgd()),
-					eSetValueWithOverwrite
-			);
-			if (xReturned != pdPASS)
-				errorFlag = pdTRUE;
-			mpbObj->setOutputsChange(false);
-		}
-	}
-
-	return;
-}
-
 uint32_t HntdTmLtchMPBttn::_otptsSttsPkg(uint32_t prevVal){
 	prevVal = DbncdMPBttn::_otptsSttsPkg(prevVal);
 	if(_pilotOn)
@@ -1450,46 +1846,46 @@ uint32_t HntdTmLtchMPBttn::_otptsSttsPkg(uint32_t prevVal){
 }
 
 void HntdTmLtchMPBttn::setFnWhnTrnOffPilotPtr(void(*newFnWhnTrnOff)()){
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	if (_fnWhnTrnOffPilot != newFnWhnTrnOff)
 		_fnWhnTrnOffPilot = newFnWhnTrnOff;
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return;
 }
 
 void HntdTmLtchMPBttn::setFnWhnTrnOffWrnngPtr(void(*newFnWhnTrnOff)()){
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	if (_fnWhnTrnOffWrnng != newFnWhnTrnOff)
 		_fnWhnTrnOffWrnng = newFnWhnTrnOff;
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return;
 }
 
 void HntdTmLtchMPBttn::setFnWhnTrnOnPilotPtr(void(*newFnWhnTrnOn)()){
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	if (_fnWhnTrnOnPilot != newFnWhnTrnOn)
 		_fnWhnTrnOnPilot = newFnWhnTrnOn;
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return;
 }
 
 void HntdTmLtchMPBttn::setFnWhnTrnOnWrnngPtr(void(*newFnWhnTrnOn)()){
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	if (_fnWhnTrnOnWrnng != newFnWhnTrnOn)
 		_fnWhnTrnOnWrnng = newFnWhnTrnOn;
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return;
 }
 
 void HntdTmLtchMPBttn::setKeepPilot(const bool &newKeepPilot){
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	if(_keepPilot != newKeepPilot)
 		_keepPilot = newKeepPilot;
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return;
 }
@@ -1497,13 +1893,13 @@ void HntdTmLtchMPBttn::setKeepPilot(const bool &newKeepPilot){
 bool HntdTmLtchMPBttn::setSrvcTime(const unsigned long int &newSrvcTime){
 	bool result {true};
 
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	if (newSrvcTime != _srvcTime){
 		result = TmLtchMPBttn::setSrvcTime(newSrvcTime);
 		if (result)
 			_wrnngMs = (_srvcTime * _wrnngPrctg) / 100;  //If the _srvcTime was changed, the _wrnngMs must be updated as it's a percentage of the first
 	}
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return result;
 }
@@ -1511,7 +1907,7 @@ bool HntdTmLtchMPBttn::setSrvcTime(const unsigned long int &newSrvcTime){
 bool HntdTmLtchMPBttn::setWrnngPrctg (const unsigned int &newWrnngPrctg){
 	bool result{false};
 
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	if(_wrnngPrctg != newWrnngPrctg){
 		if(newWrnngPrctg <= 100){
 			_wrnngPrctg = newWrnngPrctg;
@@ -1519,7 +1915,7 @@ bool HntdTmLtchMPBttn::setWrnngPrctg (const unsigned int &newWrnngPrctg){
 			result = true;
 		}
 	}
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return result;
 }
@@ -1600,12 +1996,13 @@ void HntdTmLtchMPBttn::_turnOffPilot(){
 			_fnWhnTrnOffPilot();
 	}
 	//---------------->> Flags related actions. The attribute flag is re-tested in case the tasks of functions actions reseted it's value to avoid flag related actions to be executed
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	if(_pilotOn){
 		_pilotOn = false;
 		_outputsChange = true;
+		_pushEvnt(evntPilotOff, _curPollTm);
 	}
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return;
 }
@@ -1617,12 +2014,13 @@ void HntdTmLtchMPBttn::_turnOffWrnng(){
 			_fnWhnTrnOffWrnng();
 	}
 	//---------------->> Flags related actions. The attribute flag is re-tested in case the tasks of functions actions reseted it's value to avoid flag related actions to be executed
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	if(_wrnngOn){
 		_wrnngOn = false;
 		_outputsChange = true;
+		_pushEvnt(evntWrnngOff, _curPollTm);
 	}
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return;
 }
@@ -1634,12 +2032,13 @@ void HntdTmLtchMPBttn::_turnOnPilot(){
 			_fnWhnTrnOnPilot();
 	}
 	//---------------->> Flags related actions. The attribute flag is re-tested in case the tasks of functions actions reseted it's value to avoid flag related actions to be executed
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	if(!_pilotOn){
 		_pilotOn = true;
 		_outputsChange = true;
+		_pushEvnt(evntPilotOn, _curPollTm);
 	}
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return;
 }
@@ -1651,12 +2050,13 @@ void HntdTmLtchMPBttn::_turnOnWrnng(){
 			_fnWhnTrnOnWrnng();
 	}
 	//---------------->> Flags related actions. The attribute flag is re-tested in case the tasks of functions actions reseted it's value to avoid flag related actions to be executed
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	if(!_wrnngOn){
 		_wrnngOn = true;
 		_outputsChange = true;
+		_pushEvnt(evntWrnngOn, _curPollTm);
 	}
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return;
 }
@@ -1682,10 +2082,19 @@ bool HntdTmLtchMPBttn::updPilotOn(){
 	return _pilotOn;
 }
 
+void HntdTmLtchMPBttn::updPollFlags(){
+	updValidPressesStatus();
+	updValidUnlatchStatus();
+	updWrnngOn();
+	updPilotOn();
+
+	return;
+}
+
 bool HntdTmLtchMPBttn::updWrnngOn(){
 	if(_wrnngPrctg > 0){
 		if (_isOn && _isEnabled){	//The _isEnabled evaluation is done to avoid computation of flags that will be ignored if the MPB is disablee
-			if (((xTaskGetTickCount() / portTICK_RATE_MS) - _srvcTimerStrt) >= (_srvcTime - _wrnngMs)){
+			if ((_curPollTm - _srvcTimerStrt) >= (_srvcTime - _wrnngMs)){
 				if(_wrnngOn == false){
 					_validWrnngSetPend = true;
 					_validWrnngResetPend = false;
@@ -1711,6 +2120,10 @@ XtrnUnltchMPBttn::XtrnUnltchMPBttn(GPIO_TypeDef* mpbttnPort, const uint16_t &mpb
         const bool &pulledUp,  const bool &typeNO,  const unsigned long int &dbncTimeOrigSett,  const unsigned long int &strtDelay)
 :LtchMPBttn(mpbttnPort, mpbttnPin, pulledUp, typeNO, dbncTimeOrigSett, strtDelay), _unLtchBttn{unLtchBttn}
 {
+	if(_unLtchBttn != nullptr){
+		_unLtchBttnIsOn = _unLtchBttn->getIsOn();
+		_unLtchBttnSbscrbd = _unLtchBttn->addSbscrbr(this);	//The unlatching object state changes are notified by the subscription mechanism, if the subscribers list is full the state is polled
+	}
 }
 
 XtrnUnltchMPBttn::XtrnUnltchMPBttn(gpioPinId_t mpbttnPinStrct, DbncdDlydMPBttn* unLtchBttn,
@@ -1731,6 +2144,12 @@ XtrnUnltchMPBttn::XtrnUnltchMPBttn(gpioPinId_t mpbttnPinStrct,
 {
 }
 
+XtrnUnltchMPBttn::~XtrnUnltchMPBttn(){
+	if((_unLtchBttn != nullptr) && _unLtchBttnSbscrbd)
+		_unLtchBttn->rmvSbscrbr(this);
+}
+
+#ifndef MPB_BARE_METAL
 bool XtrnUnltchMPBttn::begin(const unsigned long int &pollDelayMs){
    bool result {false};
    BaseType_t tmrModResult {pdFAIL};
@@ -1758,12 +2177,22 @@ bool XtrnUnltchMPBttn::begin(const unsigned long int &pollDelayMs){
 
    return result;
 }
+#endif
 
 void XtrnUnltchMPBttn::clrStatus(bool clrIsOn){
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	_xtrnUnltchPRlsCcl = false;
 	LtchMPBttn::clrStatus(clrIsOn);
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
+
+	return;
+}
+
+void XtrnUnltchMPBttn::_rcvPblshrChng(DbncdMPBttn* pblshr, const bool &pblshrIsOn){
+	if(pblshr == _unLtchBttn){
+		if(_unLtchBttnIsOn != pblshrIsOn)
+			_unLtchBttnIsOn = pblshrIsOn;
+	}
 
 	return;
 }
@@ -1784,12 +2213,14 @@ void XtrnUnltchMPBttn::stOffNVURP_Do(){
 void XtrnUnltchMPBttn::updValidUnlatchStatus(){
 
 	if(_unLtchBttn != nullptr){
+		if(!_unLtchBttnSbscrbd)	//No subscription available, the unlatching object state is polled
+			_unLtchBttnIsOn = _unLtchBttn->getIsOn();
 		if(_isLatched){
-			if (_unLtchBttn->getIsOn() && !_xtrnUnltchPRlsCcl){
+			if (_unLtchBttnIsOn && !_xtrnUnltchPRlsCcl){
 				_validUnlatchPend = true;
 				_xtrnUnltchPRlsCcl = true;
 			}
-			if(!_unLtchBttn->getIsOn() && _xtrnUnltchPRlsCcl){
+			if(!_unLtchBttnIsOn && _xtrnUnltchPRlsCcl){
 				_validUnlatchRlsPend = true;
 				_xtrnUnltchPRlsCcl = false;
 			}
@@ -1818,6 +2249,7 @@ DblActnLtchMPBttn::~DblActnLtchMPBttn()
 {
 }
 
+#ifndef MPB_BARE_METAL
 bool DblActnLtchMPBttn::begin(const unsigned long int &pollDelayMs) {
     bool result {false};
     BaseType_t tmrModResult {pdFAIL};
@@ -1841,16 +2273,17 @@ bool DblActnLtchMPBttn::begin(const unsigned long int &pollDelayMs) {
 
     return result;
 }
+#endif
 
 void DblActnLtchMPBttn::clrStatus(bool clrIsOn){
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	_scndModTmrStrt = 0;
 	_validScndModPend = false;
 	if(clrIsOn)
 		if(_isOnScndry)
 			_turnOffScndry();
 	LtchMPBttn::clrStatus(clrIsOn);
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return;
 }
@@ -1875,41 +2308,12 @@ unsigned long DblActnLtchMPBttn::getScndModActvDly(){
 	return _scndModActvDly;
 }
 
+#ifndef MPB_BARE_METAL
 const TaskHandle_t DblActnLtchMPBttn::getTaskWhileOnScndry(){
 
 	return _taskWhileOnScndryHndl;
 }
-
-void DblActnLtchMPBttn::mpbPollCallback(TimerHandle_t mpbTmrCbArg){
-	DblActnLtchMPBttn* mpbObj = (DblActnLtchMPBttn*)pvTimerGetTimerID(mpbTmrCbArg);
-	BaseType_t xReturned;
-
-	taskENTER_CRITICAL();
-	if(mpbObj->getIsEnabled()){
-		// Input/Output signals update
-		mpbObj->updIsPressed();
-		// Flags/Triggers calculation & update
-		mpbObj->updValidPressesStatus();
-	}
- 	// State machine state update
-	mpbObj->updFdaState();
-	taskEXIT_CRITICAL();
-
-	if (mpbObj->getOutputsChange()){
-		if(mpbObj->getTaskToNotify() != NULL){
-			xReturned = xTaskNotify(
-					mpbObj->getTaskToNotify(),	//TaskHandle_t of the task receiving notification
-					static_cast<unsigned long>(mpbObj->getOtptsSttsPkgd()),
-					eSetValueWithOverwrite
-			);
-			if (xReturned != pdPASS)
-				errorFlag = pdTRUE;
-			mpbObj->setOutputsChange(false);
-		}
-	}
-
-	return;
-}
+#endif
 
 uint32_t DblActnLtchMPBttn::_otptsSttsPkg(uint32_t prevVal){
 	prevVal = DbncdMPBttn::_otptsSttsPkg(prevVal);
@@ -1920,19 +2324,32 @@ uint32_t DblActnLtchMPBttn::_otptsSttsPkg(uint32_t prevVal){
 
 	return prevVal;
 }
+void DblActnLtchMPBttn::resetFda(){
+	mpbCrtclSctnEnter();
+	_scndModTmrStrt = 0;
+	_validScndModPend = false;
+	if(_isOnScndry)
+		_turnOffScndry();
+	LtchMPBttn::resetFda();
+	_mpbFdaState = stOffNotVPP;	//The double action state machine state, the DblActnLtchMPBttn attribute hides the LtchMPBttn one
+	mpbCrtclSctnExit();
+
+	return;
+}
+
 void DblActnLtchMPBttn::setFnWhnTrnOffScndryPtr(void (*newFnWhnTrnOff)()){
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	if (_fnWhnTrnOffScndry != newFnWhnTrnOff)
 		_fnWhnTrnOffScndry = newFnWhnTrnOff;
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 	return;
 }
 
 void DblActnLtchMPBttn::setFnWhnTrnOnScndryPtr(void (*newFnWhnTrnOn)()){
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	if (_fnWhnTrnOnScndry != newFnWhnTrnOn)
 		_fnWhnTrnOnScndry = newFnWhnTrnOn;
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return;
 }
@@ -1940,22 +2357,23 @@ void DblActnLtchMPBttn::setFnWhnTrnOnScndryPtr(void (*newFnWhnTrnOn)()){
 bool DblActnLtchMPBttn::setScndModActvDly(const unsigned long &newVal){
 	bool result {true};
 
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	if(newVal != _scndModActvDly){
 		if (newVal >= _MinSrvcTime)  	//The minimum activation time is _minActTime
 			_scndModActvDly = newVal;
 		else
 			result = false;
 	}
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return result;
 }
 
+#ifndef MPB_BARE_METAL
 void DblActnLtchMPBttn::setTaskWhileOnScndry(const TaskHandle_t &newTaskHandle){
 	eTaskState taskWhileOnStts{};
 
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	if(_taskWhileOnScndryHndl != newTaskHandle){
 		if(_taskWhileOnScndryHndl != NULL){
 			taskWhileOnStts = eTaskGetState(_taskWhileOnScndryHndl);
@@ -1969,66 +2387,73 @@ void DblActnLtchMPBttn::setTaskWhileOnScndry(const TaskHandle_t &newTaskHandle){
 		if (newTaskHandle != NULL)
 			_taskWhileOnScndryHndl = newTaskHandle;
 	}
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return;
 }
+#endif
 
 void DblActnLtchMPBttn::_turnOffScndry(){
 	if(_isOnScndry){
-		//---------------->> Tasks related actions
-		if(_taskWhileOnScndryHndl != NULL){
+#ifndef MPB_BARE_METAL
+		//---------------->> Tasks related actions. Not available when updated from an ISR, as the tasks suspending API has no ISR safe version
+		if((_taskWhileOnScndryHndl != NULL) && !xPortIsInsideInterrupt()){
 			eTaskState taskWhileOnScndryStts{eTaskGetState(_taskWhileOnScndryHndl)};
 			if (taskWhileOnScndryStts != eSuspended){
 				if(taskWhileOnScndryStts != eDeleted)
 					vTaskSuspend(_taskWhileOnScndryHndl);
 			}
 		}
+#endif
 		//---------------->> Functions related actions
 		if(_fnWhnTrnOffScndry != nullptr)
 			_fnWhnTrnOffScndry();
 	}
 	//---------------->> Flags related actions. The attribute flag is re-tested in case the tasks of functions actions reseted it's value to avoid flag related actions to be executed
 	if(_isOnScndry){
-		taskENTER_CRITICAL();
+		mpbCrtclSctnEnter();
 		if(_isOnScndry){
 			_isOnScndry = false;
 			_outputsChange = true;
+			_pushEvnt(evntScndryOff, _curPollTm);
 		}
-		taskEXIT_CRITICAL();
+		mpbCrtclSctnExit();
 	}
 	return;
 }
 
 void DblActnLtchMPBttn::_turnOnScndry(){
 	if(!_isOnScndry){
-		//---------------->> Tasks related actions
-		if(_taskWhileOnScndryHndl != NULL){
+#ifndef MPB_BARE_METAL
+		//---------------->> Tasks related actions. Not available when updated from an ISR, as the tasks suspending API has no ISR safe version
+		if((_taskWhileOnScndryHndl != NULL) && !xPortIsInsideInterrupt()){
 			eTaskState taskWhileOnScndryStts{eTaskGetState(_taskWhileOnScndryHndl)};
 			if(taskWhileOnScndryStts != eDeleted){
 				if (taskWhileOnScndryStts == eSuspended)
 					vTaskResume(_taskWhileOnScndryHndl);
 			}
 		}
+#endif
 		//---------------->> Functions related actions
 		if(_fnWhnTrnOnScndry != nullptr)
 			_fnWhnTrnOnScndry();
 	}
 	//---------------->> Flags related actions. The attribute flag is re-tested in case the tasks of functions actions reseted it's value to avoid flag related actions to be executed
 	if(!_isOnScndry){
-		taskENTER_CRITICAL();
+		mpbCrtclSctnEnter();
 		if(!_isOnScndry){
 			_isOnScndry = true;
 			_outputsChange = true;
+			_pushEvnt(evntScndryOn, _curPollTm);
 		}
-		taskEXIT_CRITICAL();
+		mpbCrtclSctnExit();
 	}
 
 	return;
 }
 
 void DblActnLtchMPBttn::updFdaState(){
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	switch(_mpbFdaState){
 		case stOffNotVPP:
 			//In: >>---------------------------------->>
@@ -2053,7 +2478,7 @@ void DblActnLtchMPBttn::updFdaState(){
 			if(!_isOn)
 				_turnOn();
 			if(_validScndModPend){
-				_scndModTmrStrt = (xTaskGetTickCount() / portTICK_RATE_MS);
+				_scndModTmrStrt = _curPollTm;
 				_mpbFdaState = stOnStrtScndMod;
 				setSttChng();
 			}
@@ -2120,7 +2545,7 @@ void DblActnLtchMPBttn::updFdaState(){
 			if(_sttChng){clrSttChng();}	// Execute this code only ONCE, when entering this state
 			//Do: >>---------------------------------->>
 			if(_validScndModPend){
-				_scndModTmrStrt = (xTaskGetTickCount() / portTICK_RATE_MS);
+				_scndModTmrStrt = _curPollTm;
 				_mpbFdaState = stOnStrtScndMod;
 				setSttChng();
 			}
@@ -2184,7 +2609,13 @@ void DblActnLtchMPBttn::updFdaState(){
 		default:
 			break;
 	}
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
+
+	return;
+}
+
+void DblActnLtchMPBttn::updPollFlags(){
+	updValidPressesStatus();
 
 	return;
 }
@@ -2194,16 +2625,18 @@ bool DblActnLtchMPBttn::updValidPressesStatus(){
 		if(_dbncRlsTimerStrt != 0)
 			_dbncRlsTimerStrt = 0;
 		if(_dbncTimerStrt == 0){    //It was not previously pressed
-			_dbncTimerStrt = xTaskGetTickCount() / portTICK_RATE_MS;	//Started to be pressed
+			_dbncTimerStrt = _curPollTm;	//Started to be pressed
 		}
 		else{
-			if (((xTaskGetTickCount() / portTICK_RATE_MS) - _dbncTimerStrt) >= ((_dbncTimeTempSett + _strtDelay) + _scndModActvDly)){
+			if ((_curPollTm - _dbncTimerStrt) >= ((_dbncTimeTempSett + _strtDelay) + _scndModActvDly)){
 				_validScndModPend = true;
 				_validPressPend = false;
-			} else if (((xTaskGetTickCount() / portTICK_RATE_MS) - _dbncTimerStrt) >= (_dbncTimeTempSett + _strtDelay)){
+			} else if ((_curPollTm - _dbncTimerStrt) >= (_dbncTimeTempSett + _strtDelay)){
 				_validPressPend = true;
 			}
 			if(_validPressPend || _validScndModPend){
+				if(!_prssRlsCcl)
+					_pushEvnt(evntVldPrss, _dbncTimerStrt);
 				_validReleasePend = false;
 				_prssRlsCcl = true;
 			}
@@ -2214,12 +2647,13 @@ bool DblActnLtchMPBttn::updValidPressesStatus(){
 			_dbncTimerStrt = 0;
 		if(!_validReleasePend && _prssRlsCcl){
 			if(_dbncRlsTimerStrt == 0){    //It was not previously pressed
-				_dbncRlsTimerStrt = xTaskGetTickCount() / portTICK_RATE_MS;	//Started to be UNpressed
+				_dbncRlsTimerStrt = _curPollTm;	//Started to be UNpressed
 			}
 			else{
-				if (((xTaskGetTickCount() / portTICK_RATE_MS) - _dbncRlsTimerStrt) >= (_dbncRlsTimeTempSett)){
+				if ((_curPollTm - _dbncRlsTimerStrt) >= (_dbncRlsTimeTempSett)){
 					_validReleasePend = true;
 					_prssRlsCcl = false;
+					_pushEvnt(evntVldRls, _dbncRlsTimerStrt);
 				}
 			}
 		}
@@ -2251,11 +2685,11 @@ DDlydDALtchMPBttn::~DDlydDALtchMPBttn()
 }
 
 void DDlydDALtchMPBttn::clrStatus(bool clrIsOn){
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	if(clrIsOn && _isOnScndry)
 		_turnOffScndry();
 	DblActnLtchMPBttn::clrStatus(clrIsOn);
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return;
 }
@@ -2307,13 +2741,44 @@ SldrDALtchMPBttn::~SldrDALtchMPBttn()
 {
 }
 
+uint32_t SldrDALtchMPBttn::_clcPwmCcrVal(uint16_t otptVal, const uint32_t &ccrMax){
+	uint32_t result {0};
+	uint32_t sldrPos {0};	//otptVal position in the [otptValMin, otptValMax] range, scaled to [0, 0xFFFF]
+	uint32_t tblIdx {0};
+	uint32_t tblPos {0};
+	uint32_t tblRmndr {0};
+
+	if(otptVal > _otptValMax)	//A value stored before a range change might be out of the current range
+		otptVal = _otptValMax;
+	else if(otptVal < _otptValMin)
+		otptVal = _otptValMin;
+	sldrPos = (((uint32_t)(otptVal - _otptValMin)) * 0xFFFF) / (_otptValMax - _otptValMin);
+	if((_pwmGmmTbl != nullptr) && (_pwmGmmTblSize > 1)){
+		tblPos = sldrPos * (uint32_t)(_pwmGmmTblSize - 1);	//Position scaled to the table intervals, each interval spanning 0xFFFF units, so the range end maps exactly to the last entry
+		tblIdx = tblPos / 0xFFFF;
+		tblRmndr = tblPos % 0xFFFF;
+		if(tblIdx >= (uint32_t)(_pwmGmmTblSize - 1)){
+			sldrPos = _pwmGmmTbl[_pwmGmmTblSize - 1];
+		}
+		else{
+			if(_pwmGmmTbl[tblIdx + 1] >= _pwmGmmTbl[tblIdx])
+				sldrPos = _pwmGmmTbl[tblIdx] + ((_pwmGmmTbl[tblIdx + 1] - _pwmGmmTbl[tblIdx]) * tblRmndr) / 0xFFFF;
+			else
+				sldrPos = _pwmGmmTbl[tblIdx] - ((_pwmGmmTbl[tblIdx] - _pwmGmmTbl[tblIdx + 1]) * tblRmndr) / 0xFFFF;
+		}
+	}
+	result = (uint32_t)((((uint64_t)sldrPos) * ccrMax) / 0xFFFF);
+
+	return result;
+}
+
 void SldrDALtchMPBttn::clrStatus(bool clrIsOn){
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	// Might the option to return the _otpCurVal to the initVal? To one the extreme values?
 	if(clrIsOn && _isOnScndry)
 		_turnOffScndry();
 	DblActnLtchMPBttn::clrStatus(clrIsOn);
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return;
 }
@@ -2333,6 +2798,11 @@ bool SldrDALtchMPBttn::getOtptCurValIsMin(){
 	return (_otptCurVal == _otptValMin);
 }
 
+const uint32_t SldrDALtchMPBttn::getPwmCcrVal(){
+
+	return _clcPwmCcrVal(_otptCurVal, _pwmCcrMax);
+}
+
 unsigned long SldrDALtchMPBttn::getOtptSldrSpd(){
 
 	return _otptSldrSpd;
@@ -2358,6 +2828,26 @@ bool SldrDALtchMPBttn::getSldrDirUp(){
 	return _curSldrDirUp;
 }
 
+bool SldrDALtchMPBttn::getSldrLzy(){
+
+	return _sldrLzy;
+}
+
+uint16_t SldrDALtchMPBttn::getSldrNtfMinDlt(){
+
+	return _sldrNtfMinDlt;
+}
+
+unsigned long SldrDALtchMPBttn::getSldrNtfMinPrd(){
+
+	return _sldrNtfMinPrd;
+}
+
+SldrRmpPrfl_t SldrDALtchMPBttn::getSldrRmpPrfl(){
+
+	return _sldrRmpPrfl;
+}
+
 uint32_t SldrDALtchMPBttn::_otptsSttsPkg(uint32_t prevVal){
 	prevVal = DblActnLtchMPBttn::_otptsSttsPkg(prevVal);
 	prevVal |= (((uint32_t)_otptCurVal) << OtptCurValBitPos);
@@ -2368,14 +2858,18 @@ uint32_t SldrDALtchMPBttn::_otptsSttsPkg(uint32_t prevVal){
 bool SldrDALtchMPBttn::setOtptCurVal(const uint16_t &newVal){
 	bool result{true};
 
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	if(_otptCurVal != newVal){
-		if(newVal >= _otptValMin && newVal <= _otptValMax)
+		if(newVal >= _otptValMin && newVal <= _otptValMax){
 			_otptCurVal = newVal;
-		else
+			_sldrLzyRbs();
+			_wrtPwmCcr();
+		}
+		else{
 			result = false;
+		}
 	}
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return result;
 }
@@ -2383,14 +2877,17 @@ bool SldrDALtchMPBttn::setOtptCurVal(const uint16_t &newVal){
 bool SldrDALtchMPBttn::setOtptSldrSpd(const uint16_t &newVal){
 	bool result{true};
 
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	if(newVal != _otptSldrSpd){
-		if(newVal > 0)
+		if(newVal > 0){
 			_otptSldrSpd = newVal;
-		else
+			_sldrLzyRbs();
+		}
+		else{
 			result = false;
+		}
 	}
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return result;
 }
@@ -2398,14 +2895,17 @@ bool SldrDALtchMPBttn::setOtptSldrSpd(const uint16_t &newVal){
 bool SldrDALtchMPBttn::setOtptSldrStpSize(const uint16_t &newVal){
 	bool result{true};
 
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	if(newVal != _otptSldrStpSize){
-		if((newVal > 0) && (newVal <= (_otptValMax - _otptValMin) / _otptSldrSpd))		//If newVal == (_otptValMax - _otptValMin) the slider will work as kind of an On/Off switch
+		if((newVal > 0) && (newVal <= (_otptValMax - _otptValMin) / _otptSldrSpd)){		//If newVal == (_otptValMax - _otptValMin) the slider will work as kind of an On/Off switch
 			_otptSldrStpSize = newVal;
-		else
+			_sldrLzyRbs();
+		}
+		else{
 			result = false;
+		}
 	}
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return result;
 }
@@ -2413,7 +2913,7 @@ bool SldrDALtchMPBttn::setOtptSldrStpSize(const uint16_t &newVal){
 bool SldrDALtchMPBttn::setOtptValMax(const uint16_t &newVal){
 	bool result{true};
 
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	if(newVal != _otptValMax){
 		if(newVal > _otptValMin){
 			_otptValMax = newVal;
@@ -2421,12 +2921,15 @@ bool SldrDALtchMPBttn::setOtptValMax(const uint16_t &newVal){
 				_otptCurVal = _otptValMax;
 				setOutputsChange(true);
 			}
+			_sldrLzyRbs();
+			_updSldrLutIdxFctr();
+			_wrtAllPwmCcr();	//The range change modifies the scaled value even if otptCurVal was not changed
 		}
 		else{
 			result = false;
 		}
 	}
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return result;
 }
@@ -2434,7 +2937,7 @@ bool SldrDALtchMPBttn::setOtptValMax(const uint16_t &newVal){
 bool SldrDALtchMPBttn::setOtptValMin(const uint16_t &newVal){
 	bool result{true};
 
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	if(newVal != _otptValMin){
 		if(newVal < _otptValMax){
 			_otptValMin = newVal;
@@ -2442,12 +2945,60 @@ bool SldrDALtchMPBttn::setOtptValMin(const uint16_t &newVal){
 				_otptCurVal = _otptValMin;
 				setOutputsChange(true);
 			}
+			_sldrLzyRbs();
+			_updSldrLutIdxFctr();
+			_wrtAllPwmCcr();	//The range change modifies the scaled value even if otptCurVal was not changed
 		}
 		else{
 			result = false;
 		}
 	}
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
+
+	return result;
+}
+
+bool SldrDALtchMPBttn::setPwmCcr(volatile uint32_t* ccrReg, const uint32_t &ccrMax){
+	bool result{false};
+
+	if(ccrMax > 0){
+		mpbCrtclSctnEnter();
+		_pwmCcrReg = ccrReg;
+		_pwmCcrMax = ccrMax;
+		_wrtPwmCcr();
+		mpbCrtclSctnExit();
+		result = true;
+	}
+
+	return result;
+}
+
+#ifdef HAL_TIM_MODULE_ENABLED
+bool SldrDALtchMPBttn::setPwmCcr(TIM_HandleTypeDef* htim, const uint32_t &tmChnnl){
+	bool result{false};
+	uint32_t tmArr{0};
+
+	if((htim != nullptr) && (htim->Instance != nullptr)){
+		tmArr = __HAL_TIM_GET_AUTORELOAD(htim);
+		if((tmChnnl == TIM_CHANNEL_1) || (tmChnnl == TIM_CHANNEL_2) || (tmChnnl == TIM_CHANNEL_3) || (tmChnnl == TIM_CHANNEL_4))
+			result = setPwmCcr(&(htim->Instance->CCR1) + (tmChnnl >> 2), tmArr);	//The CCRx registers are contiguous, the TIM_CHANNEL_x values are their offsets in bytes
+	}
+
+	return result;
+}
+#endif
+
+bool SldrDALtchMPBttn::setPwmGmmTbl(const uint16_t* gmmTbl, const uint16_t &gmmTblSize){
+	bool result{false};
+
+	if((gmmTbl == nullptr) || (gmmTblSize > 1)){
+		mpbCrtclSctnEnter();
+		_pwmGmmTbl = gmmTbl;
+		_pwmGmmTblSize = (gmmTbl == nullptr)?0:gmmTblSize;
+		_wrtAllPwmCcr();
+		mpbCrtclSctnExit();
+		result = true;
+	}
 
 	return result;
 }
@@ -2455,7 +3006,7 @@ bool SldrDALtchMPBttn::setOtptValMin(const uint16_t &newVal){
 bool SldrDALtchMPBttn::_setSldrDir(const bool &newVal){
 	bool result{true};
 
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	if(newVal != _curSldrDirUp){
 		if(newVal){	//Try to set new direction Up
 			if(_otptCurVal != _otptValMax)
@@ -2467,8 +3018,10 @@ bool SldrDALtchMPBttn::_setSldrDir(const bool &newVal){
 		}
 		if(_curSldrDirUp != newVal)
 			result = false;
+		else
+			_sldrLzyRbs();
 	}
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return result;
 }
@@ -2483,6 +3036,102 @@ bool SldrDALtchMPBttn::setSldrDirUp(){
 	return _setSldrDir(true);
 }
 
+void SldrDALtchMPBttn::setSldrLzy(const bool &newVal){
+	mpbCrtclSctnEnter();
+	if(_sldrLzy != newVal){
+		_sldrLzy = newVal;
+		_sldrRmpRst();
+	}
+	mpbCrtclSctnExit();
+
+	return;
+}
+
+void SldrDALtchMPBttn::setSldrNtfMinDlt(const uint16_t &newVal){
+	mpbCrtclSctnEnter();
+	if(_sldrNtfMinDlt != newVal)
+		_sldrNtfMinDlt = newVal;
+	mpbCrtclSctnExit();
+
+	return;
+}
+
+void SldrDALtchMPBttn::setSldrNtfMinPrd(const unsigned long &newVal){
+	mpbCrtclSctnEnter();
+	if(_sldrNtfMinPrd != newVal)
+		_sldrNtfMinPrd = newVal;
+	mpbCrtclSctnExit();
+
+	return;
+}
+
+bool SldrDALtchMPBttn::setSldrRmpAccl(const unsigned long &acclPrd, const uint8_t &acclMaxFctr){
+	bool result{false};
+
+	if((acclPrd > 0) && (acclMaxFctr > 1)){
+		mpbCrtclSctnEnter();
+		_sldrAcclPrd = acclPrd;
+		_sldrAcclMaxFctr = acclMaxFctr;
+		_sldrRmpPrfl = rmpAccl;
+		_sldrRmpRst();
+		mpbCrtclSctnExit();
+		result = true;
+	}
+
+	return result;
+}
+
+bool SldrDALtchMPBttn::setSldrRmpExp(const uint8_t &expShft){
+	bool result{false};
+
+	if((expShft > 0) && (expShft < 16)){
+		mpbCrtclSctnEnter();
+		_sldrExpShft = expShft;
+		_sldrRmpPrfl = rmpExp;
+		_sldrRmpRst();
+		mpbCrtclSctnExit();
+		result = true;
+	}
+
+	return result;
+}
+
+void SldrDALtchMPBttn::setSldrRmpLnr(){
+	mpbCrtclSctnEnter();
+	if(_sldrRmpPrfl != rmpLnr){
+		_sldrRmpPrfl = rmpLnr;
+		_sldrRmpRst();
+	}
+	mpbCrtclSctnExit();
+
+	return;
+}
+
+bool SldrDALtchMPBttn::setSldrRmpLut(const uint16_t* stpsTbl, const uint8_t &stpsTblSize){
+	bool result{false};
+
+	if((stpsTbl != nullptr) && (stpsTblSize > 0)){
+		result = true;
+		for(uint8_t i{0}; i < stpsTblSize; ++i){
+			if(stpsTbl[i] == 0){
+				result = false;
+				break;
+			}
+		}
+		if(result){
+			mpbCrtclSctnEnter();
+			_sldrLutTbl = stpsTbl;
+			_sldrLutTblSize = stpsTblSize;
+			_updSldrLutIdxFctr();
+			_sldrRmpPrfl = rmpLut;
+			_sldrRmpRst();
+			mpbCrtclSctnExit();
+		}
+	}
+
+	return result;
+}
+
 void SldrDALtchMPBttn::setSwpDirOnEnd(const bool &newVal){
 	if(_autoSwpDirOnEnd != newVal)
 		_autoSwpDirOnEnd = newVal;
@@ -2497,7 +3146,91 @@ void SldrDALtchMPBttn::setSwpDirOnPrss(const bool &newVal){
 	return;
 }
 
+void SldrDALtchMPBttn::_sldrLzyRbs(){
+	//The current otptCurVal and direction become the new lazy ramp origin, keeping the time of the last step to preserve the elapsed fraction of the current step
+	_sldrOrgnTm = _sldrLzyStpTm;
+	_sldrOrgnVal = _otptCurVal;
+	_sldrOrgnDirUp = _curSldrDirUp;
+	_sldrLzyNxtTm = _sldrLzyStpTm + _otptSldrSpd;
+
+	return;
+}
+
+uint16_t SldrDALtchMPBttn::_sldrLzyVal(const unsigned long &stpsQty, bool &dirUp){
+	uint16_t result {_sldrOrgnVal};
+	uint64_t chngSz {((uint64_t)stpsQty) * _otptSldrStpSize};
+	uint64_t rngSz {(uint64_t)(_otptValMax - _otptValMin)};
+	uint64_t toEndSz {0};
+	uint64_t bncPos {0};
+
+	dirUp = _sldrOrgnDirUp;
+	toEndSz = (dirUp)?(_otptValMax - _sldrOrgnVal):(_sldrOrgnVal - _otptValMin);
+	if((chngSz < toEndSz) || (chngSz == 0)){	//The range end is not reached
+		result = (dirUp)?(_sldrOrgnVal + chngSz):(_sldrOrgnVal - chngSz);
+	}
+	else if(!_autoSwpDirOnEnd){	//The range end is reached, the value stays there
+		result = (dirUp)?_otptValMax:_otptValMin;
+	}
+	else{	//The range end is reached and the value bounces between ends, the position after the first end is reached is periodic, the period being a round trip
+		bncPos = (chngSz - toEndSz) % (2 * rngSz);
+		if(bncPos < rngSz){
+			result = (dirUp)?(_otptValMax - bncPos):(_otptValMin + bncPos);
+			dirUp = !dirUp;
+		}
+		else{
+			result = (dirUp)?(_otptValMin + (bncPos - rngSz)):(_otptValMax - (bncPos - rngSz));
+		}
+	}
+
+	return result;
+}
+
+void SldrDALtchMPBttn::_sldrNtfFlsh(){
+	if(_sldrNtfPend){	//The slider stopped, the last value change must be notified
+		_sldrNtfPend = false;
+		_sldrLstNtfTm = _curPollTm;
+		_sldrLstNtfVal = _otptCurVal;
+		setOutputsChange(true);
+	}
+
+	return;
+}
+
+void SldrDALtchMPBttn::_sldrRmpRst(){
+	if(_mpbFdaState == stOnScndMod){	//Mode or profile changed during a ramp, the new ramp starts from the current value and time
+		_scndModTmrStrt = _curPollTm;
+		_sldrAcclFctr = 1;
+		_sldrAcclNxtTm = _curPollTm + _sldrAcclPrd;
+		_sldrNxtStpTm = _curPollTm + _otptSldrSpd;
+		_sldrLzyStpTm = _curPollTm;
+		_sldrLzyRbs();
+	}
+
+	return;
+}
+
+uint32_t SldrDALtchMPBttn::_sldrRmpStpSz(){
+	uint32_t result {_otptSldrStpSize};
+
+	switch(_sldrRmpPrfl){
+		case rmpAccl:
+			result *= _sldrAcclFctr;
+			break;
+		case rmpExp:
+			result += ((uint32_t)(_otptCurVal - _otptValMin)) >> _sldrExpShft;
+			break;
+		case rmpLut:
+			result = _sldrLutTbl[(((uint64_t)(_otptCurVal - _otptValMin)) * _sldrLutIdxFctr) >> 16];
+			break;
+		default:
+			break;
+	}
+
+	return result;
+}
+
 void SldrDALtchMPBttn::stDisabled_In(){
+	_sldrNtfFlsh();
 	if(_isOnScndry != _isOnDisabled){
 		if(_isOnDisabled)
 			_turnOnScndry();
@@ -2509,6 +3242,7 @@ void SldrDALtchMPBttn::stDisabled_In(){
 }
 
 void SldrDALtchMPBttn::stOnEndScndMod_Out(){
+	_sldrNtfFlsh();
 	if(_isOnScndry)
 		_turnOffScndry();
 
@@ -2521,40 +3255,116 @@ void SldrDALtchMPBttn::stOnScndMod_Do(){
 	uint16_t _otpStpsChng{0};
 	unsigned long _sldrTmrNxtStrt{0};
 	unsigned long _sldrTmrRemains{0};
-
-	_sldrTmrNxtStrt = (xTaskGetTickCount() / portTICK_RATE_MS);
-	_otpStpsChng = (_sldrTmrNxtStrt - _scndModTmrStrt) /_otptSldrSpd;
-	_sldrTmrRemains = ((_sldrTmrNxtStrt - _scndModTmrStrt) % _otptSldrSpd) * _otptSldrSpd;
-	_sldrTmrNxtStrt -= _sldrTmrRemains;
-	_scndModTmrStrt = _sldrTmrNxtStrt;	//This ends the time management section of the state, calculating the time
-
-	if(_curSldrDirUp){
-		// The slider is moving up
-		if(_otptCurVal != _otptValMax){
-			if((_otptValMax - _otptCurVal) >= (_otpStpsChng * _otptSldrStpSize))		//The value change is in range
-				_otptCurVal += (_otpStpsChng * _otptSldrStpSize);
-			else	//The value change goes out of range
-				_otptCurVal = _otptValMax;
+	unsigned long lzyStpsQty{0};
+	uint16_t lzyVal{0};
+	bool lzyDirUp{true};
+	uint16_t prvCurVal{_otptCurVal};
+	uint32_t rmpStpSz{0};
+	bool otptsChngPrv{_outputsChange};
+	bool valChngd{false};
+	uint16_t ntfDlt{0};
+
+	if(_sldrLzy && (_sldrRmpPrfl == rmpLnr)){
+		if((long)(_curPollTm - _sldrLzyNxtTm) >= 0){	//A new step is due, the value is calculated from the ramp origin
+			lzyStpsQty = (_curPollTm - _sldrOrgnTm) / _otptSldrSpd;
+			lzyVal = _sldrLzyVal(lzyStpsQty, lzyDirUp);
+			_curSldrDirUp = lzyDirUp;
+			if(_otptCurVal != lzyVal){
+				_otptCurVal = lzyVal;
+				setOutputsChange(true);
+			}
+			_sldrLzyStpTm = _sldrOrgnTm + (lzyStpsQty * _otptSldrSpd);
+			_sldrLzyNxtTm = _sldrLzyStpTm + _otptSldrSpd;
+		}
+	}
+	else if(_sldrRmpPrfl != rmpLnr){
+		while((long)(_curPollTm - _sldrNxtStpTm) >= 0){	//Non linear profiles are evaluated step by step, as each step size depends on the ramp state
+			if(_sldrRmpPrfl == rmpAccl){
+				while((_sldrAcclFctr < _sldrAcclMaxFctr) && ((long)(_sldrNxtStpTm - _sldrAcclNxtTm) >= 0)){
+					++_sldrAcclFctr;
+					_sldrAcclNxtTm += _sldrAcclPrd;
+				}
+			}
+			rmpStpSz = _sldrRmpStpSz();
+			if(_curSldrDirUp){
+				if((uint32_t)(_otptValMax - _otptCurVal) > rmpStpSz){
+					_otptCurVal += rmpStpSz;
+				}
+				else{
+					_otptCurVal = _otptValMax;
+					if(_autoSwpDirOnEnd == true)
+						_curSldrDirUp = false;
+				}
+			}
+			else{
+				if((uint32_t)(_otptCurVal - _otptValMin) > rmpStpSz){
+					_otptCurVal -= rmpStpSz;
+				}
+				else{
+					_otptCurVal = _otptValMin;
+					if(_autoSwpDirOnEnd == true)
+						_curSldrDirUp = true;
+				}
+			}
+			_sldrNxtStpTm += _otptSldrSpd;
+		}
+		if(_otptCurVal != prvCurVal)
 			setOutputsChange(true);
+	}
+	else{
+		_sldrTmrNxtStrt = _curPollTm;
+		_otpStpsChng = (_sldrTmrNxtStrt - _scndModTmrStrt) /_otptSldrSpd;
+		_sldrTmrRemains = (_sldrTmrNxtStrt - _scndModTmrStrt) % _otptSldrSpd;
+		_sldrTmrNxtStrt -= _sldrTmrRemains;
+		_scndModTmrStrt = _sldrTmrNxtStrt;	//This ends the time management section of the state, calculating the time
+
+		if(_curSldrDirUp){
+			// The slider is moving up
+			if(_otptCurVal != _otptValMax){
+				if((_otptValMax - _otptCurVal) >= (_otpStpsChng * _otptSldrStpSize))		//The value change is in range
+					_otptCurVal += (_otpStpsChng * _otptSldrStpSize);
+				else	//The value change goes out of range
+					_otptCurVal = _otptValMax;
+				setOutputsChange(true);
+			}
+			if(_outputsChange)
+				if(_otptCurVal == _otptValMax)
+					if(_autoSwpDirOnEnd == true)
+						_curSldrDirUp = false;
+		}
+		else{			// The slider is moving down
+			if(_otptCurVal != _otptValMin){
+				if((_otptCurVal - _otptValMin) >= (_otpStpsChng * _otptSldrStpSize))	//The value change is in range
+					_otptCurVal -= (_otpStpsChng * _otptSldrStpSize);
+				else	//The value change goes out of range
+					_otptCurVal = _otptValMin;
+				setOutputsChange(true);
+			}
+			if(_outputsChange)
+				if(_otptCurVal == _otptValMin)
+					if(_autoSwpDirOnEnd == true)
+						_curSldrDirUp = true;
 		}
-		if(_outputsChange)
-			if(_otptCurVal == _otptValMax)
-				if(_autoSwpDirOnEnd == true)
-					_curSldrDirUp = false;
 	}
-	else{			// The slider is moving down
-		if(_otptCurVal != _otptValMin){
-			if((_otptCurVal - _otptValMin) >= (_otpStpsChng * _otptSldrStpSize))	//The value change is in range
-				_otptCurVal -= (_otpStpsChng * _otptSldrStpSize);
-			else	//The value change goes out of range
-				_otptCurVal = _otptValMin;
+	valChngd = (_otptCurVal != prvCurVal);
+	if(!otptsChngPrv && !valChngd)
+		setOutputsChange(false);	//No value change in this poll, no notification needed
+	if(valChngd || _sldrNtfPend){	//Notifications throttling: rate limit and deadband, the range limits are always notified
+		ntfDlt = (_otptCurVal > _sldrLstNtfVal)?(_otptCurVal - _sldrLstNtfVal):(_sldrLstNtfVal - _otptCurVal);
+		if(((_curPollTm - _sldrLstNtfTm) >= _sldrNtfMinPrd) && ((ntfDlt >= _sldrNtfMinDlt) || (_otptCurVal == _otptValMax) || (_otptCurVal == _otptValMin))){
+			_sldrNtfPend = false;
+			_sldrLstNtfTm = _curPollTm;
+			_sldrLstNtfVal = _otptCurVal;
 			setOutputsChange(true);
 		}
-		if(_outputsChange)
-			if(_otptCurVal == _otptValMin)
-				if(_autoSwpDirOnEnd == true)
-					_curSldrDirUp = true;
+		else if(valChngd){
+			_sldrNtfPend = true;
+			if(!otptsChngPrv)
+				setOutputsChange(false);
+		}
 	}
+	if(valChngd)
+		_wrtPwmCcr();
 
 	return;
 }
@@ -2564,6 +3374,14 @@ void SldrDALtchMPBttn::stOnStrtScndMod_In(){
 		_turnOnScndry();
 	if(_autoSwpDirOnPrss)
 		swapSldrDir();
+	_sldrLzyStpTm = _curPollTm;	//The lazy ramp origin is set at the secondary mode start
+	_sldrLzyRbs();
+	_sldrAcclFctr = 1;
+	_sldrAcclNxtTm = _curPollTm + _sldrAcclPrd;
+	_sldrNxtStpTm = _curPollTm + _otptSldrSpd;
+	_sldrLstNtfTm = _curPollTm - _sldrNtfMinPrd;	//The first ramp change is notified without delay
+	_sldrLstNtfVal = _otptCurVal;
+	_sldrNtfPend = false;
 
 	return;
 }
@@ -2573,90 +3391,322 @@ bool SldrDALtchMPBttn::swapSldrDir(){
 	return _setSldrDir(!_curSldrDirUp);
 }
 
+void SldrDALtchMPBttn::_updSldrLutIdxFctr(){
+	//The factor to get the table index from the position in the range with a multiplication and a shift, avoiding per step divisions
+	if(_sldrLutTblSize > 0)
+		_sldrLutIdxFctr = (((uint32_t)_sldrLutTblSize) << 16) / (((uint32_t)(_otptValMax - _otptValMin)) + 1);
+
+	return;
+}
+
+void SldrDALtchMPBttn::_wrtAllPwmCcr(){
+	_wrtPwmCcr();
+
+	return;
+}
+
+void SldrDALtchMPBttn::_wrtPwmCcr(){
+	if(_pwmCcrReg != nullptr)
+		*_pwmCcrReg = getPwmCcrVal();
+
+	return;
+}
+
 //=========================================================================> Class methods delimiter
 
-VdblMPBttn::VdblMPBttn(GPIO_TypeDef* mpbttnPort, const uint16_t &mpbttnPin, const bool &pulledUp, const bool &typeNO, const unsigned long int &dbncTimeOrigSett, const unsigned long int &strtDelay, const bool &isOnDisabled)
-:DbncdDlydMPBttn(mpbttnPort, mpbttnPin, pulledUp, typeNO, dbncTimeOrigSett, strtDelay)
+MltChnlSldrDALtchMPBttn::MltChnlSldrDALtchMPBttn(GPIO_TypeDef* mpbttnPort, const uint16_t &mpbttnPin, const bool &pulledUp, const bool &typeNO, const unsigned long &dbncTimeOrigSett, const unsigned long int &strtDelay, const uint8_t &chnlsCnt, const uint16_t initVal)
+:SldrDALtchMPBttn(mpbttnPort, mpbttnPin, pulledUp, typeNO, dbncTimeOrigSett, strtDelay, initVal), _chnlsCnt{chnlsCnt}
 {
-	_isOnDisabled = isOnDisabled;
+	if(_chnlsCnt < 1)
+		_chnlsCnt = 1;
+	else if(_chnlsCnt > _MltChnlSldrMaxChnls)
+		_chnlsCnt = _MltChnlSldrMaxChnls;
+	for(uint8_t i{0}; i < _chnlsCnt; ++i){
+		_chnlsVal[i] = initVal;
+		_chnlsDirUp[i] = true;
+	}
 }
 
-VdblMPBttn::VdblMPBttn(gpioPinId_t mpbttnPinStrct, const bool &pulledUp, const bool &typeNO, const unsigned long int &dbncTimeOrigSett, const unsigned long int &strtDelay, const bool &isOnDisabled)
-:VdblMPBttn(mpbttnPinStrct.portId, mpbttnPinStrct.pinNum, pulledUp, typeNO, dbncTimeOrigSett, strtDelay, isOnDisabled)
+MltChnlSldrDALtchMPBttn::MltChnlSldrDALtchMPBttn(gpioPinId_t mpbttnPinStrct, const bool &pulledUp, const bool &typeNO, const unsigned long &dbncTimeOrigSett, const unsigned long int &strtDelay, const uint8_t &chnlsCnt, const uint16_t initVal)
+:MltChnlSldrDALtchMPBttn(mpbttnPinStrct.portId, mpbttnPinStrct.pinNum, pulledUp, typeNO, dbncTimeOrigSett, strtDelay, chnlsCnt, initVal)
 {
 }
 
-VdblMPBttn::~VdblMPBttn()
+MltChnlSldrDALtchMPBttn::~MltChnlSldrDALtchMPBttn()
 {
 }
 
-void VdblMPBttn::clrStatus(bool clrIsOn){
-	taskENTER_CRITICAL();
-	if(_isVoided)
-		setIsNotVoided();
-	DbncdMPBttn::clrStatus(clrIsOn);
-	taskEXIT_CRITICAL();
+const uint8_t MltChnlSldrDALtchMPBttn::getActvChnl() const{
 
-	return;
+	return _actvChnl;
 }
 
-fncPtrType VdblMPBttn::getFnWhnTrnOffVdd(){
+const bool MltChnlSldrDALtchMPBttn::getAutoChngChnl() const{
 
-	return _fnWhnTrnOffVdd;
+	return _autoChngChnl;
 }
 
-fncPtrType VdblMPBttn::getFnWhnTrnOnVdd(){
+const uint8_t MltChnlSldrDALtchMPBttn::getChnlsCnt() const{
 
-	return _fnWhnTrnOnVdd;
+	return _chnlsCnt;
 }
 
-bool VdblMPBttn::getFrcOtptLvldWhnVdd(){
+uint64_t MltChnlSldrDALtchMPBttn::getChnlsPkgd(){
+	uint64_t result {0};
 
-	return _frcOtptLvlWhnVdd;
+	mpbCrtclSctnEnter();
+	_svActvChnl();
+	for(uint8_t i{0}; i < _chnlsCnt; ++i)
+		result |= ((uint64_t)_chnlsVal[i]) << (16 * i);
+	mpbCrtclSctnExit();
+
+	return result;
 }
 
-const bool VdblMPBttn::getIsVoided() const{
+uint16_t MltChnlSldrDALtchMPBttn::getChnlVal(const uint8_t &chnl){
+	uint16_t result {0};
 
-    return _isVoided;
+	if(chnl < _chnlsCnt)
+		result = (chnl == _actvChnl)?_otptCurVal:_chnlsVal[chnl];
+
+	return result;
 }
 
-bool VdblMPBttn::getStOnWhnOtpFrcd(){
+fncChnlsChngPtrType MltChnlSldrDALtchMPBttn::getFnWhnChnlsChng(){
 
-	return _stOnWhnOtptFrcd;
+	return _fnWhnChnlsChng;
 }
 
-void VdblMPBttn::mpbPollCallback(TimerHandle_t mpbTmrCbArg){
-	VdblMPBttn* mpbObj = (VdblMPBttn*)pvTimerGetTimerID(mpbTmrCbArg);
-	BaseType_t xReturned;
+void MltChnlSldrDALtchMPBttn::_ldActvChnl(){
+	//The range settings are shared, a stored channel value might be out of the current range
+	if(_chnlsVal[_actvChnl] > _otptValMax)
+		_chnlsVal[_actvChnl] = _otptValMax;
+	else if(_chnlsVal[_actvChnl] < _otptValMin)
+		_chnlsVal[_actvChnl] = _otptValMin;
+	_otptCurVal = _chnlsVal[_actvChnl];
+	_curSldrDirUp = _chnlsDirUp[_actvChnl];
+	_sldrRmpRst();
+	_sldrLzyRbs();
+	_wrtPwmCcr();	//Only the loaded channel bound register is written, with it's own value
 
-	taskENTER_CRITICAL();
-	if(mpbObj->getIsEnabled()){
-		// Input/Output signals update
-		mpbObj->updIsPressed();
-		// Flags/Triggers calculation & update
-		mpbObj->updValidPressesStatus();
-		mpbObj->updVoidStatus();
-	}
- 	// State machine state update
-	mpbObj->updFdaState();
-	taskEXIT_CRITICAL();
-
-	if (mpbObj->getOutputsChange()){
-		if(mpbObj->getTaskToNotify() != NULL){
-			xReturned = xTaskNotify(
-					mpbObj->getTaskToNotify(),	//TaskHandle_t of the task receiving notification
-					static_cast<unsigned long>(mpbObj->getOtptsSttsPkgd()),
-					eSetValueWithOverwrite
-			);
-			if (xReturned != pdPASS)
-				errorFlag = pdTRUE;
-			mpbObj->setOutputsChange(false);
+	return;
+}
+
+void MltChnlSldrDALtchMPBttn::_notifyOtptsChng(){
+	bool chnlsNtfd {false};
+
+	if(_outputsChange && (_fnWhnChnlsChng != nullptr)){
+		_fnWhnChnlsChng(getChnlsPkgd());
+		chnlsNtfd = true;
+	}
+	SldrDALtchMPBttn::_notifyOtptsChng();
+	if(chnlsNtfd)
+		setOutputsChange(false);	//The change was delivered, as done for the outputs change function
+
+	return;
+}
+
+uint32_t MltChnlSldrDALtchMPBttn::_otptsSttsPkg(uint32_t prevVal){
+	prevVal = SldrDALtchMPBttn::_otptsSttsPkg(prevVal);
+	prevVal |= (((uint32_t)_actvChnl) & 0x03) << ActvChnlBitPos;
+
+	return prevVal;
+}
+
+bool MltChnlSldrDALtchMPBttn::setActvChnl(const uint8_t &newVal){
+	bool result{true};
+
+	mpbCrtclSctnEnter();
+	if(newVal != _actvChnl){
+		if(newVal < _chnlsCnt){
+			_svActvChnl();
+			_actvChnl = newVal;
+			_ldActvChnl();
+			setOutputsChange(true);
+		}
+		else{
+			result = false;
 		}
 	}
+	mpbCrtclSctnExit();
+
+	return result;
+}
+
+void MltChnlSldrDALtchMPBttn::setAutoChngChnl(const bool &newVal){
+	if(_autoChngChnl != newVal)
+		_autoChngChnl = newVal;
+
+	return;
+}
+
+bool MltChnlSldrDALtchMPBttn::setChnlVal(const uint8_t &chnl, const uint16_t &newVal){
+	bool result{false};
+
+	if((chnl < _chnlsCnt) && (newVal >= _otptValMin) && (newVal <= _otptValMax)){
+		mpbCrtclSctnEnter();
+		if(chnl == _actvChnl){
+			result = setOtptCurVal(newVal);
+		}
+		else{
+			if(_chnlsVal[chnl] != newVal){
+				_chnlsVal[chnl] = newVal;
+				_wrtChnlPwmCcr(chnl);
+				setOutputsChange(true);
+			}
+			result = true;
+		}
+		mpbCrtclSctnExit();
+	}
+
+	return result;
+}
+
+void MltChnlSldrDALtchMPBttn::setFnWhnChnlsChngPtr(void (*newFnWhnChnlsChng)(uint64_t)){
+	mpbCrtclSctnEnter();
+	if (_fnWhnChnlsChng != newFnWhnChnlsChng)
+		_fnWhnChnlsChng = newFnWhnChnlsChng;
+	mpbCrtclSctnExit();
+
+	return;
+}
+
+bool MltChnlSldrDALtchMPBttn::setPwmCcr(const uint8_t &chnl, volatile uint32_t* ccrReg, const uint32_t &ccrMax){
+	bool result{false};
+
+	if(chnl < _chnlsCnt){
+		if(chnl == 0){	//The channel 0 binding is the inherited one
+			result = SldrDALtchMPBttn::setPwmCcr(ccrReg, ccrMax);
+		}
+		else if(ccrMax > 0){
+			mpbCrtclSctnEnter();
+			_chnlsCcrReg[chnl] = ccrReg;
+			_chnlsCcrMax[chnl] = ccrMax;
+			_wrtChnlPwmCcr(chnl);
+			mpbCrtclSctnExit();
+			result = true;
+		}
+	}
+
+	return result;
+}
+
+#ifdef HAL_TIM_MODULE_ENABLED
+bool MltChnlSldrDALtchMPBttn::setPwmCcr(const uint8_t &chnl, TIM_HandleTypeDef* htim, const uint32_t &tmChnnl){
+	bool result{false};
+	uint32_t tmArr{0};
+
+	if((htim != nullptr) && (htim->Instance != nullptr)){
+		tmArr = __HAL_TIM_GET_AUTORELOAD(htim);
+		if((tmChnnl == TIM_CHANNEL_1) || (tmChnnl == TIM_CHANNEL_2) || (tmChnnl == TIM_CHANNEL_3) || (tmChnnl == TIM_CHANNEL_4))
+			result = setPwmCcr(chnl, &(htim->Instance->CCR1) + (tmChnnl >> 2), tmArr);	//The CCRx registers are contiguous, the TIM_CHANNEL_x values are their offsets in bytes
+	}
+
+	return result;
+}
+#endif
+
+void MltChnlSldrDALtchMPBttn::_svActvChnl(){
+	_chnlsVal[_actvChnl] = _otptCurVal;
+	_chnlsDirUp[_actvChnl] = _curSldrDirUp;
+
+	return;
+}
+
+void MltChnlSldrDALtchMPBttn::stOnEndScndMod_Out(){
+	SldrDALtchMPBttn::stOnEndScndMod_Out();
+	if(_autoChngChnl && (_chnlsCnt > 1)){	//The next long press will ramp the next channel
+		_svActvChnl();
+		_actvChnl = (_actvChnl + 1) % _chnlsCnt;
+		_ldActvChnl();
+		setOutputsChange(true);
+	}
+
+	return;
+}
+
+void MltChnlSldrDALtchMPBttn::stOnScndMod_Do(){
+	SldrDALtchMPBttn::stOnScndMod_Do();
+	if(_outputsChange)
+		_svActvChnl();
+
+	return;
+}
+
+void MltChnlSldrDALtchMPBttn::_wrtAllPwmCcr(){
+	for(uint8_t i{0}; i < _chnlsCnt; ++i)
+		_wrtChnlPwmCcr(i);
+
+	return;
+}
+
+void MltChnlSldrDALtchMPBttn::_wrtChnlPwmCcr(const uint8_t &chnl){
+	volatile uint32_t* ccrReg {(chnl == 0)?_pwmCcrReg:_chnlsCcrReg[chnl]};
+
+	if(ccrReg != nullptr)
+		*ccrReg = _clcPwmCcrVal((chnl == _actvChnl)?_otptCurVal:_chnlsVal[chnl], (chnl == 0)?_pwmCcrMax:_chnlsCcrMax[chnl]);
+
+	return;
+}
+
+void MltChnlSldrDALtchMPBttn::_wrtPwmCcr(){
+	_wrtChnlPwmCcr(_actvChnl);
+
+	return;
+}
+
+//=========================================================================> Class methods delimiter
+
+VdblMPBttn::VdblMPBttn(GPIO_TypeDef* mpbttnPort, const uint16_t &mpbttnPin, const bool &pulledUp, const bool &typeNO, const unsigned long int &dbncTimeOrigSett, const unsigned long int &strtDelay, const bool &isOnDisabled)
+:DbncdDlydMPBttn(mpbttnPort, mpbttnPin, pulledUp, typeNO, dbncTimeOrigSett, strtDelay)
+{
+	_isOnDisabled = isOnDisabled;
+}
+
+VdblMPBttn::VdblMPBttn(gpioPinId_t mpbttnPinStrct, const bool &pulledUp, const bool &typeNO, const unsigned long int &dbncTimeOrigSett, const unsigned long int &strtDelay, const bool &isOnDisabled)
+:VdblMPBttn(mpbttnPinStrct.portId, mpbttnPinStrct.pinNum, pulledUp, typeNO, dbncTimeOrigSett, strtDelay, isOnDisabled)
+{
+}
+
+VdblMPBttn::~VdblMPBttn()
+{
+}
+
+void VdblMPBttn::clrStatus(bool clrIsOn){
+	mpbCrtclSctnEnter();
+	if(_isVoided)
+		setIsNotVoided();
+	DbncdMPBttn::clrStatus(clrIsOn);
+	mpbCrtclSctnExit();
 
 	return;
 }
 
+fncPtrType VdblMPBttn::getFnWhnTrnOffVdd(){
+
+	return _fnWhnTrnOffVdd;
+}
+
+fncPtrType VdblMPBttn::getFnWhnTrnOnVdd(){
+
+	return _fnWhnTrnOnVdd;
+}
+
+bool VdblMPBttn::getFrcOtptLvldWhnVdd(){
+
+	return _frcOtptLvlWhnVdd;
+}
+
+const bool VdblMPBttn::getIsVoided() const{
+
+    return _isVoided;
+}
+
+bool VdblMPBttn::getStOnWhnOtpFrcd(){
+
+	return _stOnWhnOtptFrcd;
+}
+
 uint32_t VdblMPBttn::_otptsSttsPkg(uint32_t prevVal){
 	prevVal = DbncdMPBttn::_otptsSttsPkg(prevVal);
 
@@ -2669,30 +3719,30 @@ uint32_t VdblMPBttn::_otptsSttsPkg(uint32_t prevVal){
 }
 
 void VdblMPBttn::setFnWhnTrnOffVddPtr(void(*newFnWhnTrnOff)()){
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	if (_fnWhnTrnOffVdd != newFnWhnTrnOff)
 		_fnWhnTrnOffVdd = newFnWhnTrnOff;
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return;
 
 }
 
 void VdblMPBttn::setFnWhnTrnOnVddtPtr(void(*newFnWhnTrnOn)()){
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	if (_fnWhnTrnOnVdd != newFnWhnTrnOn)
 		_fnWhnTrnOnVdd = newFnWhnTrnOn;
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return;
 
 }
 
 void VdblMPBttn::setFrcdOtptWhnVdd(const bool &newVal){
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	if(_frcOtptLvlWhnVdd != newVal)
 		_frcOtptLvlWhnVdd = newVal;
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return;
 }
@@ -2708,23 +3758,23 @@ bool VdblMPBttn::setIsVoided(){
 }
 
 void VdblMPBttn::setStOnWhnOtpFrcd(const bool &newVal){
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	if(_stOnWhnOtptFrcd != newVal)
 		_stOnWhnOtptFrcd = newVal;
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return;
 }
 
 bool VdblMPBttn::setVoided(const bool &newVoidValue){
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	if(_isVoided != newVoidValue){
 		if(newVoidValue)
 			_turnOnVdd();
 		else
 			_turnOffVdd();
 	}
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return true;
 }
@@ -2753,13 +3803,14 @@ void VdblMPBttn::_turnOffVdd(){
 		if(_fnWhnTrnOffVdd != nullptr)
 			_fnWhnTrnOffVdd();
 	}
-	//---------------->> Flags related actions. The attribute flag is re-tested in case the tasks of functions actions reseted it's value to avoid flag related actions to be executed	taskENTER_CRITICAL();
-	taskENTER_CRITICAL();
+	//---------------->> Flags related actions. The attribute flag is re-tested in case the tasks of functions actions reseted it's value to avoid flag related actions to be executed	mpbCrtclSctnEnter();
+	mpbCrtclSctnEnter();
 	if(_isVoided){
 		_isVoided = false;
 		_outputsChange = true;
+		_pushEvnt(evntUnvdd, _curPollTm);
 	}
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return;
 }
@@ -2770,19 +3821,20 @@ void VdblMPBttn::_turnOnVdd(){
 		if(_fnWhnTrnOnVdd != nullptr)
 			_fnWhnTrnOnVdd();
 	}
-	//---------------->> Flags related actions. The attribute flag is re-tested in case the tasks of functions actions reseted it's value to avoid flag related actions to be executed	taskENTER_CRITICAL();
-	taskENTER_CRITICAL();
+	//---------------->> Flags related actions. The attribute flag is re-tested in case the tasks of functions actions reseted it's value to avoid flag related actions to be executed	mpbCrtclSctnEnter();
+	mpbCrtclSctnEnter();
 	if(!_isVoided){
 		_isVoided = true;
 		_outputsChange = true;
+		_pushEvnt(evntVdd, _curPollTm);
 	}
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
 
 	return;
 }
 
 void VdblMPBttn::updFdaState(){
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
 	switch(_mpbFdaState){
 		case stOffNotVPP:
 			//In: >>---------------------------------->>
@@ -2962,7 +4014,14 @@ void VdblMPBttn::updFdaState(){
 	default:
 		break;
 	}
-	taskEXIT_CRITICAL();
+	mpbCrtclSctnExit();
+
+	return;
+}
+
+void VdblMPBttn::updPollFlags(){
+	updValidPressesStatus();
+	updVoidStatus();
 
 	return;
 }
@@ -2983,6 +4042,7 @@ TmVdblMPBttn::~TmVdblMPBttn()
 {
 }
 
+#ifndef MPB_BARE_METAL
 bool TmVdblMPBttn::begin(const unsigned long int &pollDelayMs){
    bool result {false};
    BaseType_t tmrModResult {pdFAIL};
@@ -3004,12 +4064,13 @@ bool TmVdblMPBttn::begin(const unsigned long int &pollDelayMs){
 
    return result;
 }
+#endif
 
 void TmVdblMPBttn::clrStatus(){
-	taskENTER_CRITICAL();
+	mpbCrtclSctnEnter();
    _voidTmrStrt = 0;
    VdblMPBttn::clrStatus();
-   taskEXIT_CRITICAL();
+   mpbCrtclSctnExit();
 
    return;
 }
@@ -3022,14 +4083,14 @@ const unsigned long int TmVdblMPBttn::getVoidTime() const{
 bool TmVdblMPBttn::setVoidTime(const unsigned long int &newVoidTime){
     bool result{true};
 
-    taskENTER_CRITICAL();
+    mpbCrtclSctnEnter();
     if(newVoidTime != _voidTime){
    	 if(newVoidTime >= _MinSrvcTime)
    		 _voidTime = newVoidTime;
    	 else
    		 result = false;
     }
-    taskEXIT_CRITICAL();
+    mpbCrtclSctnExit();
 
     return result;
 }
@@ -3049,7 +4110,7 @@ void TmVdblMPBttn::stOffVddNVUP_Do(){
 }
 
 void TmVdblMPBttn::stOffVPP_Do(){	// This provides a setting point for the voiding mechanism to be started
-   _voidTmrStrt = xTaskGetTickCount() / portTICK_RATE_MS;
+   _voidTmrStrt = _curPollTm;
 
 	return;
 }
@@ -3063,7 +4124,7 @@ bool TmVdblMPBttn::updVoidStatus(){
    bool result {false};
 
    if(_voidTmrStrt != 0)
-		if (((xTaskGetTickCount() / portTICK_RATE_MS) - _voidTmrStrt) >= (_voidTime)) // + _dbncTimeTempSett + _strtDelay
+		if ((_curPollTm - _voidTmrStrt) >= (_voidTime)) // + _dbncTimeTempSett + _strtDelay
 			 result = true;
    _validVoidPend = result;
 
@@ -3089,6 +4150,7 @@ SnglSrvcVdblMPBttn::~SnglSrvcVdblMPBttn()
 {
 }
 
+#ifndef MPB_BARE_METAL
 bool SnglSrvcVdblMPBttn::begin(const unsigned long int &pollDelayMs){
    bool result {false};
    BaseType_t tmrModResult {pdFAIL};
@@ -3110,11 +4172,14 @@ bool SnglSrvcVdblMPBttn::begin(const unsigned long int &pollDelayMs){
 
    return result;
 }
+#endif
 
+#ifndef MPB_BARE_METAL
 void SnglSrvcVdblMPBttn::setTaskWhileOn(const TaskHandle_t &newTaskHandle){
 
 	return;
 }
+#endif
 
 void SnglSrvcVdblMPBttn::stOffVddNVUP_Do(){
 	if(_validReleasePend){
@@ -3137,63 +4202,2830 @@ bool SnglSrvcVdblMPBttn::updVoidStatus(){
 
 //=========================================================================> Class methods delimiter
 
-/**
- * @brief Returns the position of the single set bit on an unsigned 16 bits integer value.
- *
- * @param mask A 16 bits single bit set unsigned integer
- * @return The position of the single bit set on the parameter value
- * - An unsigned 8 bits integer in the range 0 ~ 15 if the parameter is a single bit set value indicating the position of that set bit.
- * - 0xFF otherwise.
- */
-uint8_t singleBitPosNum(uint16_t mask){
-	uint8_t result{0xFF};
+const int8_t RtryEncdrMPBttn::_encdrTbl[16] {0, -1, 1, 0, 1, 0, 0, -1, -1, 0, 0, 1, 0, 1, -1, 0};	//Quarter step for each ((previous state << 2) | current state) transition, the state being ((A << 1) | B). The invalid transitions -indexes 3, 6, 9 and 12- produce no step
 
-	if((mask > 0) && (mask & (mask - 1)) == 0){
-		result = 0;
-		mask = mask >> 1;
-		while (mask > 0){
-			mask = mask >> 1;
-			++result;
-		}
+RtryEncdrMPBttn::RtryEncdrMPBttn(GPIO_TypeDef* mpbttnPort, const uint16_t &mpbttnPin, gpioPinId_t encdrAPin, gpioPinId_t encdrBPin, const bool &pulledUp, const bool &typeNO, const unsigned long int &dbncTimeOrigSett, const unsigned long int &strtDelay)
+:DbncdDlydMPBttn(mpbttnPort, mpbttnPin, pulledUp, typeNO, dbncTimeOrigSett, strtDelay), _encdrAPin{encdrAPin}, _encdrBPin{encdrBPin}
+{
+	_encdrCfgPins();
+	_encdrSt = _rdEncdr();
+}
+
+RtryEncdrMPBttn::RtryEncdrMPBttn(gpioPinId_t mpbttnPinStrct, gpioPinId_t encdrAPin, gpioPinId_t encdrBPin, const bool &pulledUp, const bool &typeNO, const unsigned long int &dbncTimeOrigSett, const unsigned long int &strtDelay)
+:RtryEncdrMPBttn(mpbttnPinStrct.portId, mpbttnPinStrct.pinNum, encdrAPin, encdrBPin, pulledUp, typeNO, dbncTimeOrigSett, strtDelay)
+{
+}
+
+RtryEncdrMPBttn::~RtryEncdrMPBttn()
+{
+}
+
+void RtryEncdrMPBttn::encdrIsr(const unsigned long int &curTm){
+	if(_encdrExti){
+		mpbCrtclSctnEnter();
+		if(_isEnabled)
+			_updEncdr(curTm);
+		else
+			_encdrSt = _rdEncdr();	//The channels state is tracked while disabled, to avoid false steps when enabled
+		mpbCrtclSctnExit();
 	}
 
-	return result;
+	return;
 }
 
-MpbOtpts_t otptsSttsUnpkg(uint32_t pkgOtpts){
-	MpbOtpts_t mpbCurSttsDcdd {0};
+void RtryEncdrMPBttn::_encdrCfgPins(){
+	if((_encdrAPin.portId != nullptr) && (_encdrBPin.portId != nullptr)){
+		/*Configure the channels pins*/
+		GPIO_InitTypeDef GPIO_InitStruct {0};
 
-	if(pkgOtpts & (((uint32_t)1) << IsOnBitPos))
-		mpbCurSttsDcdd.isOn = true;
-	else
-		mpbCurSttsDcdd.isOn = false;
+		GPIO_InitStruct.Mode = (_encdrExti)?GPIO_MODE_IT_RISING_FALLING:GPIO_MODE_INPUT;
+		GPIO_InitStruct.Pull = (_pulledUp == true)?GPIO_PULLUP:GPIO_PULLDOWN;
+		GPIO_InitStruct.Pin = _encdrAPin.pinNum;
+		HAL_GPIO_Init(_encdrAPin.portId, &GPIO_InitStruct);
+		GPIO_InitStruct.Pin = _encdrBPin.pinNum;
+		HAL_GPIO_Init(_encdrBPin.portId, &GPIO_InitStruct);
+	}
 
-	if(pkgOtpts & (((uint32_t)1) << IsEnabledBitPos))
-		mpbCurSttsDcdd.isEnabled = true;
-	else
-		mpbCurSttsDcdd.isEnabled = false;
+	return;
+}
 
-	// From here on the attribute flags are not present in every subclass!!
-	if(pkgOtpts & (((uint32_t)1) << PilotOnBitPos))
-		mpbCurSttsDcdd.pilotOn = true;
-	else
-		mpbCurSttsDcdd.pilotOn = false;
+const int32_t RtryEncdrMPBttn::getDtntsCnt() const{
 
-	if(pkgOtpts & (((uint32_t)1) << WrnngOnBitPos))
-		mpbCurSttsDcdd.wrnngOn = true;
-	else
-		mpbCurSttsDcdd.wrnngOn = false;
+	return _dtntsCnt;
+}
 
-	if(pkgOtpts & (((uint32_t)1) << IsVoidedBitPos))
-		mpbCurSttsDcdd.isVoided = true;
-	else
-		mpbCurSttsDcdd.isVoided = false;
+const uint32_t RtryEncdrMPBttn::getEncdrErrsCnt() const{
 
-	if(pkgOtpts & (((uint32_t)1) << IsOnScndryBitPos))
-		mpbCurSttsDcdd.isOnScndry = true;
-	else
-		mpbCurSttsDcdd.isOnScndry = false;
+	return _encdrErrsCnt;
+}
+
+const bool RtryEncdrMPBttn::getEncdrExti() const{
+
+	return _encdrExti;
+}
+
+const uint16_t RtryEncdrMPBttn::getOtptCurVal() const{
+
+	return _otptCurVal;
+}
+
+const uint16_t RtryEncdrMPBttn::getOtptStpSize() const{
+
+	return _otptStpSize;
+}
+
+const uint16_t RtryEncdrMPBttn::getOtptValMax() const{
+
+	return _otptValMax;
+}
+
+const uint16_t RtryEncdrMPBttn::getOtptValMin() const{
+
+	return _otptValMin;
+}
+
+const bool RtryEncdrMPBttn::getOtptWrp() const{
+
+	return _otptWrp;
+}
+
+const uint8_t RtryEncdrMPBttn::getStpsPerDtnt() const{
+
+	return _stpsPerDtnt;
+}
+
+const int32_t RtryEncdrMPBttn::getVlcty() const{
+
+	return _vlcty;
+}
+
+uint32_t RtryEncdrMPBttn::_otptsSttsPkg(uint32_t prevVal){
+	prevVal = DbncdMPBttn::_otptsSttsPkg(prevVal);
+	prevVal |= (((uint32_t)_otptCurVal) << OtptCurValBitPos);
+
+	return prevVal;
+}
+
+uint8_t RtryEncdrMPBttn::_rdEncdr(){
+	uint8_t result {_encdrSt};
+
+	if((_encdrAPin.portId != nullptr) && (_encdrBPin.portId != nullptr)){
+		uint32_t aPortVal {_encdrAPin.portId->IDR};
+		uint32_t bPortVal {(_encdrBPin.portId == _encdrAPin.portId)?aPortVal:(uint32_t)(_encdrBPin.portId->IDR)};	//Channels in the same port are sampled by a single access
+
+		result = (((aPortVal & _encdrAPin.pinNum) != 0)?2:0) | (((bPortVal & _encdrBPin.pinNum) != 0)?1:0);
+		if(_pulledUp)
+			result ^= 3;	//A closed channel contact is kept as a set bit
+	}
+
+	return result;
+}
+
+void RtryEncdrMPBttn::setEncdrExti(const bool &newEncdrExti){
+	mpbCrtclSctnEnter();
+	if(_encdrExti != newEncdrExti){
+		_encdrExti = newEncdrExti;
+		_encdrCfgPins();
+		_encdrSt = _rdEncdr();
+	}
+	mpbCrtclSctnExit();
+
+	return;
+}
+
+bool RtryEncdrMPBttn::setOtptCurVal(const uint16_t &newVal){
+	bool result{true};
+
+	mpbCrtclSctnEnter();
+	if(_otptCurVal != newVal){
+		if((newVal >= _otptValMin) && (newVal <= _otptValMax)){
+			_otptCurVal = newVal;
+			setOutputsChange(true);
+		}
+		else{
+			result = false;
+		}
+	}
+	mpbCrtclSctnExit();
+
+	return result;
+}
+
+bool RtryEncdrMPBttn::setOtptStpSize(const uint16_t &newVal){
+	bool result{false};
+
+	if(newVal > 0){
+		mpbCrtclSctnEnter();
+		if(_otptStpSize != newVal)
+			_otptStpSize = newVal;
+		mpbCrtclSctnExit();
+		result = true;
+	}
+
+	return result;
+}
+
+bool RtryEncdrMPBttn::setOtptValMax(const uint16_t &newVal){
+	bool result{true};
+
+	mpbCrtclSctnEnter();
+	if(newVal != _otptValMax){
+		if(newVal > _otptValMin){
+			_otptValMax = newVal;
+			if(_otptCurVal > _otptValMax){
+				_otptCurVal = _otptValMax;
+				setOutputsChange(true);
+			}
+		}
+		else{
+			result = false;
+		}
+	}
+	mpbCrtclSctnExit();
+
+	return result;
+}
+
+bool RtryEncdrMPBttn::setOtptValMin(const uint16_t &newVal){
+	bool result{true};
+
+	mpbCrtclSctnEnter();
+	if(newVal != _otptValMin){
+		if(newVal < _otptValMax){
+			_otptValMin = newVal;
+			if(_otptCurVal < _otptValMin){
+				_otptCurVal = _otptValMin;
+				setOutputsChange(true);
+			}
+		}
+		else{
+			result = false;
+		}
+	}
+	mpbCrtclSctnExit();
+
+	return result;
+}
+
+void RtryEncdrMPBttn::setOtptWrp(const bool &newOtptWrp){
+	mpbCrtclSctnEnter();
+	if(_otptWrp != newOtptWrp)
+		_otptWrp = newOtptWrp;
+	mpbCrtclSctnExit();
+
+	return;
+}
+
+bool RtryEncdrMPBttn::setStpsPerDtnt(const uint8_t &newStpsPerDtnt){
+	bool result{false};
+
+	if((newStpsPerDtnt == 1) || (newStpsPerDtnt == 2) || (newStpsPerDtnt == 4)){
+		mpbCrtclSctnEnter();
+		if(_stpsPerDtnt != newStpsPerDtnt){
+			_stpsPerDtnt = newStpsPerDtnt;
+			_qrtrStps = 0;
+		}
+		mpbCrtclSctnExit();
+		result = true;
+	}
+
+	return result;
+}
+
+void RtryEncdrMPBttn::_updEncdr(const unsigned long int &curTm){
+	uint8_t curSt {_rdEncdr()};
+	int8_t qrtrStp {0};
+	int8_t dtntDir {0};
+	uint16_t newVal {_otptCurVal};
+	unsigned long int dtntPrd {0};
+
+	if(curSt != _encdrSt){
+		qrtrStp = _encdrTbl[(_encdrSt << 2) | curSt];
+		_encdrSt = curSt;
+		if(qrtrStp == 0){
+			++_encdrErrsCnt;
+		}
+		else{
+			_qrtrStps += qrtrStp;
+			if(_qrtrStps >= _stpsPerDtnt)
+				dtntDir = 1;
+			else if(_qrtrStps <= -_stpsPerDtnt)
+				dtntDir = -1;
+		}
+	}
+	if(dtntDir != 0){
+		_qrtrStps = 0;
+		_dtntsCnt += dtntDir;
+		//Velocity: the period from the previous detent in the same direction, averaged with the previous value. A first detent gets the minimum measurable velocity
+		dtntPrd = curTm - _lstDtntTm;
+		if((_vlcty != 0) && ((_vlcty > 0) == (dtntDir > 0)) && (dtntPrd <= _RtryEncdrVlctyTmOut))
+			_vlcty = dtntDir * ((((_vlcty > 0)?_vlcty:-_vlcty) + (int32_t)(1000 / ((dtntPrd > 0)?dtntPrd:1))) / 2);
+		else
+			_vlcty = dtntDir * (1000 / _RtryEncdrVlctyTmOut);
+		_lstDtntTm = curTm;
+		//otptCurVal: a step that exceeds a range limit first sets the value to the limit, the next one wraps around if configured
+		if(dtntDir > 0){
+			if((_otptValMax - _otptCurVal) >= _otptStpSize)
+				newVal = _otptCurVal + _otptStpSize;
+			else if(_otptWrp && (_otptCurVal == _otptValMax))
+				newVal = _otptValMin;
+			else
+				newVal = _otptValMax;
+		}
+		else{
+			if((_otptCurVal - _otptValMin) >= _otptStpSize)
+				newVal = _otptCurVal - _otptStpSize;
+			else if(_otptWrp && (_otptCurVal == _otptValMin))
+				newVal = _otptValMax;
+			else
+				newVal = _otptValMin;
+		}
+		if(_otptCurVal != newVal){
+			_otptCurVal = newVal;
+			setOutputsChange(true);
+		}
+	}
+
+	return;
+}
+
+void RtryEncdrMPBttn::updFdaState(){
+	if(!_isEnabled && !_encdrExti)
+		_encdrSt = _rdEncdr();	//The channels state is tracked by the polls while disabled, as done by encdrIsr(), to avoid false steps -or counted errors- when enabled
+	DbncdDlydMPBttn::updFdaState();
+
+	return;
+}
+
+void RtryEncdrMPBttn::updPollFlags(){
+	DbncdDlydMPBttn::updPollFlags();
+	if(!_encdrExti)
+		_updEncdr(_curPollTm);
+	if((_vlcty != 0) && ((_curPollTm - _lstDtntTm) > _RtryEncdrVlctyTmOut))
+		_vlcty = 0;
+
+	return;
+}
+
+//=========================================================================> Class methods delimiter
+
+PlsCntrMPBttn::PlsCntrMPBttn(GPIO_TypeDef* mpbttnPort, const uint16_t &mpbttnPin, const bool &pulledUp, const bool &typeNO, const unsigned long int &dbncTimeOrigSett)
+:DbncdMPBttn(mpbttnPort, mpbttnPin, pulledUp, typeNO, dbncTimeOrigSett)
+{
+}
+
+PlsCntrMPBttn::PlsCntrMPBttn(gpioPinId_t mpbttnPinStrct, const bool &pulledUp, const bool &typeNO, const unsigned long int &dbncTimeOrigSett)
+:DbncdMPBttn(mpbttnPinStrct, pulledUp, typeNO, dbncTimeOrigSett)
+{
+}
+
+PlsCntrMPBttn::~PlsCntrMPBttn()
+{
+}
+
+const uint32_t PlsCntrMPBttn::getPlsCnt() const{
+
+	return _plsCnt;
+}
+
+const bool PlsCntrMPBttn::getPlsIsrSmpl() const{
+
+	return _plsIsrSmpl;
+}
+
+const uint32_t PlsCntrMPBttn::getPlsMinWdth() const{
+
+	return _plsMinWdth;
+}
+
+const uint32_t PlsCntrMPBttn::getPlsNtfStp() const{
+
+	return _plsNtfStp;
+}
+
+const uint32_t PlsCntrMPBttn::getPlsRt() const{
+
+	return _plsRt;
+}
+
+const unsigned long int PlsCntrMPBttn::getPlsRtPrd() const{
+
+	return _plsRtPrd;
+}
+
+uint32_t PlsCntrMPBttn::_otptsSttsPkg(uint32_t prevVal){
+	prevVal = DbncdMPBttn::_otptsSttsPkg(prevVal);
+	prevVal |= ((_plsCnt & 0xFFFF) << OtptCurValBitPos);
+
+	return prevVal;
+}
+
+void PlsCntrMPBttn::rstPlsCnt(){
+	mpbCrtclSctnEnter();
+	_plsCnt = 0;
+	_plsRtPrdStrtCnt = 0;
+	_plsRtPrdStrtTm = _curPollTm;
+	_plsNtfNxtCnt = _plsNtfStp;
+	setOutputsChange(true);
+	mpbCrtclSctnExit();
+
+	return;
+}
+
+void PlsCntrMPBttn::setPlsIsrSmpl(const bool &newPlsIsrSmpl){
+	mpbCrtclSctnEnter();
+	if(_plsIsrSmpl != newPlsIsrSmpl){
+		_plsIsrSmpl = newPlsIsrSmpl;
+		_plsRawLvl = _plsStblLvl;	//The time references of both modes are unrelated, a level change in progress is discarded
+	}
+	mpbCrtclSctnExit();
+
+	return;
+}
+
+void PlsCntrMPBttn::setPlsMinWdth(const uint32_t &newVal){
+	mpbCrtclSctnEnter();
+	if(_plsMinWdth != newVal)
+		_plsMinWdth = newVal;
+	mpbCrtclSctnExit();
+
+	return;
+}
+
+void PlsCntrMPBttn::setPlsNtfStp(const uint32_t &newVal){
+	mpbCrtclSctnEnter();
+	if(_plsNtfStp != newVal){
+		_plsNtfStp = newVal;
+		if(_plsNtfStp > 0)
+			_plsNtfNxtCnt = _plsCnt - (_plsCnt % _plsNtfStp) + _plsNtfStp;
+	}
+	mpbCrtclSctnExit();
+
+	return;
+}
+
+bool PlsCntrMPBttn::setPlsRtPrd(const unsigned long int &newVal){
+	bool result {false};
+
+	if(newVal > 0){
+		mpbCrtclSctnEnter();
+		if(_plsRtPrd != newVal)
+			_plsRtPrd = newVal;
+		mpbCrtclSctnExit();
+		result = true;
+	}
+
+	return result;
+}
+
+void PlsCntrMPBttn::smplIsr(const uint32_t &curTmUs){
+	if(_plsIsrSmpl){
+		mpbCrtclSctnEnter();
+		if(_isEnabled)
+			_smplPls(curTmUs);
+		mpbCrtclSctnExit();
+	}
+
+	return;
+}
+
+void PlsCntrMPBttn::_smplPls(const uint32_t &curTmUs){
+	bool curLvl {_rdPrssSt()};	//The raw input level is read with no side effect, as when invoked from smplIsr() the debounced state must be kept
+
+	//A level is accepted when kept for the minimum pulse width. When sampled by edge interrupts the level ending at the edge is validated by it's duration, when sampled periodically it's validated as soon as it lasted the minimum width
+	if(curLvl != _plsRawLvl){
+		if((_plsRawLvl != _plsStblLvl) && ((curTmUs - _plsRawTm) >= _plsMinWdth)){
+			_plsStblLvl = _plsRawLvl;
+			if(_plsStblLvl)
+				++_plsCnt;
+		}
+		_plsRawLvl = curLvl;
+		_plsRawTm = curTmUs;
+	}
+	else if((_plsRawLvl != _plsStblLvl) && ((curTmUs - _plsRawTm) >= _plsMinWdth)){
+		_plsStblLvl = _plsRawLvl;
+		if(_plsStblLvl)
+			++_plsCnt;
+	}
+
+	return;
+}
+
+bool PlsCntrMPBttn::updIsPressed(){
+	uint32_t curCnt {0};
+	uint32_t prvRt {_plsRt};
+
+	if(!_plsIsrSmpl)
+		_smplPls(static_cast<uint32_t>(_curPollTm) * 1000U);
+	curCnt = _plsCnt;
+	if((_curPollTm - _plsRtPrdStrtTm) >= _plsRtPrd){	//Rate period end: the outputs change is signaled if pulses were counted or the rate changed
+		_plsRt = static_cast<uint32_t>((((uint64_t)(curCnt - _plsRtPrdStrtCnt)) * 1000000) / (_curPollTm - _plsRtPrdStrtTm));
+		if((_plsRt != prvRt) || (curCnt != _plsRtPrdStrtCnt))
+			setOutputsChange(true);
+		_plsRtPrdStrtTm = _curPollTm;
+		_plsRtPrdStrtCnt = curCnt;
+	}
+	if((_plsNtfStp > 0) && (static_cast<int32_t>(curCnt - _plsNtfNxtCnt) >= 0)){
+		setOutputsChange(true);
+		_plsNtfNxtCnt = curCnt - (curCnt % _plsNtfStp) + _plsNtfStp;
+	}
+	_isPressed = (_plsRt > 0);	//The isOn flag signals pulses being received
+
+	return _isPressed;
+}
+
+//=========================================================================> Class methods delimiter
+
+SlctrSwtchMPBttn::SlctrSwtchMPBttn(gpioPinId_t* pstnsPins, const uint8_t &pstnsCnt, const bool &pulledUp, const unsigned long int &dbncTimeOrigSett)
+:DbncdMPBttn(nullptr, _InvalidPinNum, pulledUp, true, dbncTimeOrigSett)
+{
+	_pulledUp = pulledUp;
+	if((pstnsPins != nullptr) && (pstnsCnt > 0) && (pstnsCnt <= _SlctrSwtchMaxPstns)){
+		GPIO_InitTypeDef GPIO_InitStruct {0};
+		uint8_t portIdx {0};
+
+		_pstnsCnt = pstnsCnt;
+		/*Configure the positions pins. The distinct ports are listed, to read each port once per sample*/
+		GPIO_InitStruct.Mode = GPIO_MODE_INPUT;
+		GPIO_InitStruct.Pull = (_pulledUp)?GPIO_PULLUP:GPIO_PULLDOWN;
+		for(uint8_t i{0}; i < _pstnsCnt; ++i){
+			_pstnsPins[i] = pstnsPins[i];
+			GPIO_InitStruct.Pin = _pstnsPins[i].pinNum;
+			HAL_GPIO_Init(_pstnsPins[i].portId, &GPIO_InitStruct);
+			portIdx = 0;
+			while((portIdx < _pstnsPortsCnt) && (_pstnsPorts[portIdx] != _pstnsPins[i].portId))
+				++portIdx;
+			if(portIdx == _pstnsPortsCnt){
+				_pstnsPorts[_pstnsPortsCnt] = _pstnsPins[i].portId;
+				++_pstnsPortsCnt;
+			}
+			_pstnsPortIdx[i] = portIdx;
+		}
+	}
+}
+
+SlctrSwtchMPBttn::~SlctrSwtchMPBttn()
+{
+}
+
+const unsigned long int SlctrSwtchMPBttn::getBrkTmOut() const{
+
+	return _brkTmOut;
+}
+
+const uint8_t SlctrSwtchMPBttn::getCurPstn() const{
+
+	return _curPstn;
+}
+
+const uint32_t SlctrSwtchMPBttn::getInvldCodesCnt() const{
+
+	return _invldCodesCnt;
+}
+
+const uint8_t SlctrSwtchMPBttn::getPstnsCnt() const{
+
+	return _pstnsCnt;
+}
+
+const bool SlctrSwtchMPBttn::getSlctrFlt() const{
+
+	return _slctrFlt;
+}
+
+const uint16_t SlctrSwtchMPBttn::getStblCode() const{
+
+	return _stblCode;
+}
+
+uint32_t SlctrSwtchMPBttn::_otptsSttsPkg(uint32_t prevVal){
+	prevVal = DbncdMPBttn::_otptsSttsPkg(prevVal);
+	prevVal |= (((uint32_t)_curPstn) << OtptCurValBitPos);
+
+	return prevVal;
+}
+
+uint16_t SlctrSwtchMPBttn::_rdPstnCode(){
+	uint32_t portsIdr[_SlctrSwtchMaxPstns]{};
+	uint16_t result {0};
+
+	for(uint8_t i{0}; i < _pstnsPortsCnt; ++i)
+		portsIdr[i] = _pstnsPorts[i]->IDR;
+	for(uint8_t i{0}; i < _pstnsCnt; ++i){
+		if(((portsIdr[_pstnsPortIdx[i]] & _pstnsPins[i].pinNum) != 0) != _pulledUp)
+			result |= (1 << i);
+	}
+
+	return result;
+}
+
+void SlctrSwtchMPBttn::setBrkTmOut(const unsigned long int &newVal){
+	mpbCrtclSctnEnter();
+	if(_brkTmOut != newVal)
+		_brkTmOut = newVal;
+	mpbCrtclSctnExit();
+
+	return;
+}
+
+bool SlctrSwtchMPBttn::updIsPressed(){
+	uint16_t curCode {_rdPstnCode()};
+	bool slctrFlt {_slctrFlt};
+
+	if(curCode != _cndtCode){
+		_cndtCode = curCode;
+		_cndtTm = _curPollTm;
+	}
+	else if((_cndtCode != _stblCode) && ((_curPollTm - _cndtTm) >= _dbncTimeTempSett)){	//The position code was kept for the debounce time
+		_stblCode = _cndtCode;
+		if(_stblCode == 0){
+			//Between positions, the current position is kept until the break time out
+		}
+		else if((_stblCode & (_stblCode - 1)) == 0){
+			slctrFlt = false;
+			if(_curPstn != singleBitPosNum(_stblCode)){
+				_curPstn = singleBitPosNum(_stblCode);
+				setOutputsChange(true);
+			}
+		}
+		else{
+			slctrFlt = true;
+			++_invldCodesCnt;
+		}
+	}
+	if((_stblCode == 0) && (_cndtCode == 0) && ((_curPollTm - _cndtTm) >= _brkTmOut))
+		slctrFlt = true;
+	if(_pstnsCnt == 0)
+		slctrFlt = true;
+	if(_slctrFlt != slctrFlt){
+		_slctrFlt = slctrFlt;
+		setOutputsChange(true);
+	}
+	_isPressed = (!_slctrFlt) && (_curPstn != 0xFF);
+
+	return _isPressed;
+}
+
+//=========================================================================> Class methods delimiter
+
+TwoHndMPBttn::TwoHndMPBttn(gpioPinId_t lftPin, gpioPinId_t rghtPin, const bool &pulledUp, const bool &typeNO, const unsigned long int &dbncTimeOrigSett)
+:DbncdMPBttn(nullptr, _InvalidPinNum, pulledUp, typeNO, dbncTimeOrigSett)
+{
+	GPIO_InitTypeDef GPIO_InitStruct {0};
+
+	_pulledUp = pulledUp;
+	_chnlsPins[0] = lftPin;
+	_chnlsPins[1] = rghtPin;
+	/*Configure the channels pins*/
+	GPIO_InitStruct.Mode = GPIO_MODE_INPUT;
+	GPIO_InitStruct.Pull = (_pulledUp)?GPIO_PULLUP:GPIO_PULLDOWN;
+	for(uint8_t i{0}; i < 2; ++i){
+		if((_chnlsPins[i].portId != NULL) && (_chnlsPins[i].pinNum != _InvalidPinNum)){
+			mpbGpioClkEnbl(_chnlsPins[i].portId);	//The base class constructor gets no pin, an unclocked pulled up port would read as both channels pressed
+			GPIO_InitStruct.Pin = _chnlsPins[i].pinNum;
+			HAL_GPIO_Init(_chnlsPins[i].portId, &GPIO_InitStruct);
+		}
+	}
+}
+
+TwoHndMPBttn::~TwoHndMPBttn()
+{
+}
+
+const bool TwoHndMPBttn::getChnlSt(const uint8_t &chnlIdx) const{
+
+	return (chnlIdx < 2) && _chnlStbl[chnlIdx];
+}
+
+const uint32_t TwoHndMPBttn::getCyclsCnt() const{
+
+	return _cyclsCnt;
+}
+
+const unsigned long int TwoHndMPBttn::getLstPrssDlt() const{
+
+	return _lstPrssDlt;
+}
+
+const uint32_t TwoHndMPBttn::getSmltntyFlsCnt() const{
+
+	return _smltntyFlsCnt;
+}
+
+const unsigned long int TwoHndMPBttn::getSmltntyWndw() const{
+
+	return _smltntyWndw;
+}
+
+const TwoHndMPBttn::twoHndStts TwoHndMPBttn::getTwoHndStt() const{
+
+	return _twoHndStt;
+}
+
+uint32_t TwoHndMPBttn::_otptsSttsPkg(uint32_t prevVal){
+	prevVal = DbncdMPBttn::_otptsSttsPkg(prevVal);
+	prevVal |= (((uint32_t)_twoHndStt) << OtptCurValBitPos);
+
+	return prevVal;
+}
+
+void TwoHndMPBttn::_rdChnls(bool* chnlsSt){
+	uint32_t portIdr[2]{};
+
+	if(_chnlsInptSrc != nullptr){
+		for(uint8_t i{0}; i < 2; ++i)
+			chnlsSt[i] = (_chnlsInptSrc->getInptSt(_chnlsInptIdx[i]) == _typeNO);
+	}
+	else{
+		//Both ports are read back to back, a single read when both pins are in the same port
+		if(_chnlsPins[0].portId != NULL)
+			portIdr[0] = _chnlsPins[0].portId->IDR;
+		if(_chnlsPins[1].portId == _chnlsPins[0].portId)
+			portIdr[1] = portIdr[0];
+		else if(_chnlsPins[1].portId != NULL)
+			portIdr[1] = _chnlsPins[1].portId->IDR;
+		for(uint8_t i{0}; i < 2; ++i){
+			if((_chnlsPins[i].portId != NULL) && (_chnlsPins[i].pinNum != _InvalidPinNum))
+				chnlsSt[i] = ((((portIdr[i] & _chnlsPins[i].pinNum) != 0) != _pulledUp) == _typeNO);
+			else
+				chnlsSt[i] = false;
+		}
+	}
+
+	return;
+}
+
+bool TwoHndMPBttn::setChnlsInptSrc(MpbInptSrc* newInptSrc, const uint16_t &lftIdx, const uint16_t &rghtIdx){
+	bool result {true};
+
+	if((newInptSrc != nullptr) && ((lftIdx >= newInptSrc->getInptsCnt()) || (rghtIdx >= newInptSrc->getInptsCnt())))
+		result = false;
+	if(result){
+		mpbCrtclSctnEnter();
+		if(_chnlsInptSrc != newInptSrc)
+			_chnlsInptSrc = newInptSrc;
+		_chnlsInptIdx[0] = lftIdx;
+		_chnlsInptIdx[1] = rghtIdx;
+		mpbCrtclSctnExit();
+	}
+
+	return result;
+}
+
+void TwoHndMPBttn::setSmltntyWndw(const unsigned long int &newVal){
+	mpbCrtclSctnEnter();
+	if(_smltntyWndw != newVal)
+		_smltntyWndw = newVal;
+	mpbCrtclSctnExit();
+
+	return;
+}
+
+void TwoHndMPBttn::_setTwoHndStt(const twoHndStts &newStt){
+	if(_twoHndStt != newStt){
+		_twoHndStt = newStt;
+		setOutputsChange(true);
+	}
+
+	return;
+}
+
+bool TwoHndMPBttn::updIsPressed(){
+	bool chnlsSt[2]{};
+	uint8_t frstIdx {0};
+
+	_rdChnls(chnlsSt);
+	for(uint8_t i{0}; i < 2; ++i){	//Each channel is debounced independently, the press time stamp is the start of the debounced press
+		if(chnlsSt[i] != _chnlRaw[i]){
+			_chnlRaw[i] = chnlsSt[i];
+			_chnlRawTm[i] = _curPollTm;
+		}
+		else if((_chnlStbl[i] != _chnlRaw[i]) && ((_curPollTm - _chnlRawTm[i]) >= (_chnlRaw[i]?_dbncTimeTempSett:_dbncRlsTimeTempSett))){
+			_chnlStbl[i] = _chnlRaw[i];
+			if(_chnlStbl[i])
+				_chnlPrssTm[i] = _chnlRawTm[i];
+		}
+	}
+	if((_twoHndStt == thArmd) && (_chnlStbl[0] || _chnlStbl[1]))
+		_setTwoHndStt(thWtng);
+	else if((_twoHndStt == thOn) && !(_chnlStbl[0] && _chnlStbl[1]))	//Either channel released ends the cycle
+		_setTwoHndStt(thBlckd);
+	if(_twoHndStt == thWtng){	//Evaluated in the same pass the state was entered, so simultaneous presses set the output in the same poll
+		frstIdx = (_chnlStbl[0] && (!_chnlStbl[1] || (_chnlPrssTm[0] <= _chnlPrssTm[1])))?0:1;
+		if(_chnlStbl[0] && _chnlStbl[1]){
+			_lstPrssDlt = _chnlPrssTm[1 - frstIdx] - _chnlPrssTm[frstIdx];
+			if(_lstPrssDlt <= _smltntyWndw){
+				++_cyclsCnt;
+				_setTwoHndStt(thOn);
+			}
+			else{
+				++_smltntyFlsCnt;
+				_setTwoHndStt(thBlckd);
+			}
+		}
+		else if(!(_chnlStbl[0] || _chnlStbl[1])){	//The single pressed channel was released before the window expired
+			_setTwoHndStt(thArmd);
+		}
+		else if((_chnlRaw[1 - frstIdx])?((_chnlRawTm[1 - frstIdx] - _chnlPrssTm[frstIdx]) > _smltntyWndw):((_curPollTm - _chnlPrssTm[frstIdx]) > _smltntyWndw)){	//The second press started too late or not at all
+			++_smltntyFlsCnt;
+			_setTwoHndStt(thBlckd);
+		}
+	}
+	if((_twoHndStt == thBlckd) && !(_chnlStbl[0] || _chnlStbl[1]))
+		_setTwoHndStt(thArmd);
+	_isPressed = (_twoHndStt == thOn);
+
+	return _isPressed;
+}
+
+bool TwoHndMPBttn::updValidPressesStatus(){
+	//The channels are already debounced, the two-hand condition is validated with no added delay
+	if(_isPressed != _prssRlsCcl){
+		_prssRlsCcl = _isPressed;
+		if(_isPressed){
+			_validPressPend = true;
+			_validReleasePend = false;
+			_pushEvnt(evntVldPrss, _curPollTm);
+		}
+		else{
+			_validReleasePend = true;
+			_pushEvnt(evntVldRls, _curPollTm);
+		}
+	}
+
+	return (_validPressPend||_validReleasePend);
+}
+
+//=========================================================================> Class methods delimiter
+
+MpbGrp::MpbGrp()
+{
+}
+
+MpbGrp::~MpbGrp()
+{
+}
+
+bool MpbGrp::addInptSrc(MpbInptSrc* newInptSrc){
+	bool result {false};
+
+	if(newInptSrc != nullptr){
+		mpbCrtclSctnEnter();
+		if(_inptSrcsCnt < _MpbGrpMaxInptSrcs){
+			result = true;
+			for(uint8_t i{0}; i < _inptSrcsCnt; ++i){
+				if(_inptSrcsArr[i] == newInptSrc){
+					result = false;
+					break;
+				}
+			}
+			if(result){
+				_inptSrcsArr[_inptSrcsCnt] = newInptSrc;
+				++_inptSrcsCnt;
+			}
+		}
+		mpbCrtclSctnExit();
+	}
+
+	return result;
+}
+
+bool MpbGrp::addMpb(DbncdMPBttn* newMpb){
+	bool result {false};
+
+	if(newMpb != nullptr){
+		mpbCrtclSctnEnter();
+		if((_mpbsCnt < _MpbGrpMaxSize) && (getMpbIdx(newMpb) == 0xFF)){
+			_mpbsArr[_mpbsCnt] = newMpb;
+			++_mpbsCnt;
+			_evalOrdrVld = false;
+			result = true;
+		}
+		mpbCrtclSctnExit();
+	}
+
+	return result;
+}
+
+bool MpbGrp::bindOtpt(DbncdMPBttn* mpb, const uint8_t &otptBitPos, gpioPinId_t otptPin, const bool &actvHigh){
+	bool result {false};
+	bool pinBound {false};
+
+	if((mpb != nullptr) && (otptBitPos < OtptCurValBitPos) && (otptPin.portId != nullptr) && (otptPin.pinNum != 0) && ((otptPin.pinNum & (otptPin.pinNum - 1)) == 0)){	//The pin must be identified by a single-bit mask
+		mpbCrtclSctnEnter();
+		for(uint8_t i{0}; i < _otptBndngsCnt; ++i){
+			if((_otptBndngsArr[i].port == otptPin.portId) && (_otptBndngsArr[i].pin == otptPin.pinNum)){
+				pinBound = true;
+				break;
+			}
+		}
+		if((!pinBound) && (_otptBndngsCnt < _MpbGrpMaxOtptBndngs) && (getMpbIdx(mpb) != 0xFF)){
+			_otptBndngsArr[_otptBndngsCnt] = {mpb, otptBitPos, otptPin.portId, otptPin.pinNum, actvHigh};
+			++_otptBndngsCnt;
+			result = true;
+		}
+		mpbCrtclSctnExit();
+		if(result){
+			/*Configure GPIO pin : otptPin, set to it's inactive level before being enabled as output*/
+			GPIO_InitTypeDef GPIO_InitStruct {0};
+
+			HAL_GPIO_WritePin(otptPin.portId, otptPin.pinNum, (actvHigh)?GPIO_PIN_RESET:GPIO_PIN_SET);
+			GPIO_InitStruct.Pin = otptPin.pinNum;
+			GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
+			GPIO_InitStruct.Pull = GPIO_NOPULL;
+			GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
+			HAL_GPIO_Init(otptPin.portId, &GPIO_InitStruct);
+		}
+	}
+
+	return result;
+}
+
+const bool MpbGrp::getDpndncsCycl(){
+	if(!_evalOrdrVld || (_evalOrdrSbscrptnsVer != DbncdMPBttn::getSbscrptnsVer()))
+		_sortEvalOrdr();
+
+	return _dpndncsCycl;
+}
+
+const uint8_t MpbGrp::getInptSrcsCnt() const{
+
+	return _inptSrcsCnt;
+}
+
+DbncdMPBttn* MpbGrp::getEvalMpb(const uint8_t &evalPos){
+	DbncdMPBttn* result {nullptr};
+
+	if(!_evalOrdrVld || (_evalOrdrSbscrptnsVer != DbncdMPBttn::getSbscrptnsVer()))
+		_sortEvalOrdr();
+	if(evalPos < _mpbsCnt)
+		result = _mpbsArr[_evalOrdr[evalPos]];
+
+	return result;
+}
+
+DbncdMPBttn* MpbGrp::getMpb(const uint8_t &mpbIdx){
+	DbncdMPBttn* result {nullptr};
+
+	if(mpbIdx < _mpbsCnt)
+		result = _mpbsArr[mpbIdx];
+
+	return result;
+}
+
+const uint8_t MpbGrp::getMpbsCnt() const{
+
+	return _mpbsCnt;
+}
+
+const uint8_t MpbGrp::getOtptBndngsCnt() const{
+
+	return _otptBndngsCnt;
+}
+
+uint8_t MpbGrp::getMpbIdx(DbncdMPBttn* mpb){
+	uint8_t result {0xFF};
+
+	for(uint8_t i{0}; i < _mpbsCnt; ++i){
+		if(_mpbsArr[i] == mpb){
+			result = i;
+			break;
+		}
+	}
+
+	return result;
+}
+
+uint8_t MpbGrp::getSnpsht(uint32_t* otptsPkgsArr, const uint8_t &arrSize, uint32_t* isOnBtmp){
+	uint8_t result {0};
+
+	if(otptsPkgsArr != nullptr){
+		mpbCrtclSctnEnter();
+		result = (_mpbsCnt < arrSize)?_mpbsCnt:arrSize;
+		if(isOnBtmp != nullptr){
+			for(uint8_t i{0}; i < ((result + 31) / 32); ++i)
+				isOnBtmp[i] = 0;
+		}
+		for(uint8_t i{0}; i < result; ++i){
+			otptsPkgsArr[i] = _mpbsArr[i]->getOtptsSttsPkgd();
+			if((isOnBtmp != nullptr) && (otptsPkgsArr[i] & (((uint32_t)1) << IsOnBitPos)))
+				isOnBtmp[i / 32] |= ((uint32_t)1) << (i % 32);
+		}
+		mpbCrtclSctnExit();
+	}
+
+	return result;
+}
+
+bool MpbGrp::rmvInptSrc(MpbInptSrc* inptSrc){
+	bool result {false};
+
+	mpbCrtclSctnEnter();
+	for(uint8_t i{0}; i < _inptSrcsCnt; ++i){
+		if(_inptSrcsArr[i] == inptSrc){
+			for(uint8_t j{i}; j < (_inptSrcsCnt - 1); ++j)
+				_inptSrcsArr[j] = _inptSrcsArr[j + 1];
+			--_inptSrcsCnt;
+			_inptSrcsArr[_inptSrcsCnt] = nullptr;
+			result = true;
+			break;
+		}
+	}
+	mpbCrtclSctnExit();
+
+	return result;
+}
+
+bool MpbGrp::rmvMpb(DbncdMPBttn* mpb){
+	bool result {false};
+	uint8_t mpbIdx {0xFF};
+
+	mpbCrtclSctnEnter();
+	mpbIdx = getMpbIdx(mpb);
+	if(mpbIdx != 0xFF){
+		for(uint8_t i{mpbIdx}; i < (_mpbsCnt - 1); ++i)
+			_mpbsArr[i] = _mpbsArr[i + 1];
+		--_mpbsCnt;
+		_mpbsArr[_mpbsCnt] = nullptr;
+		_evalOrdrVld = false;
+		for(uint8_t i{0}; i < _otptBndngsCnt;){	//The removed object output bindings are removed
+			if(_otptBndngsArr[i].mpb == mpb){
+				for(uint8_t j{i}; j < (_otptBndngsCnt - 1); ++j)
+					_otptBndngsArr[j] = _otptBndngsArr[j + 1];
+				--_otptBndngsCnt;
+			}
+			else{
+				++i;
+			}
+		}
+		result = true;
+	}
+	mpbCrtclSctnExit();
+
+	return result;
+}
+
+void MpbGrp::scanInptSrcs(const unsigned long int &curTm){
+	for(uint8_t i{0}; i < _inptSrcsCnt; ++i)
+		_inptSrcsArr[i]->scan(curTm);
+
+	return;
+}
+
+void MpbGrp::_sortEvalOrdr(){
+	//Topological sorting of the registered objects, each object is placed after the registered objects it's subscribed to. In each step the first object -in registration order- with no pending publishers is placed
+	uint8_t pndngPblshrs[_MpbGrpMaxSize]{};
+	bool isPlcd[_MpbGrpMaxSize]{};
+	uint8_t plcdCnt {0};
+	uint8_t sbscrbrIdx {0};
+	bool plcdFnd {false};
+
+	mpbCrtclSctnEnter();
+	_dpndncsCycl = false;
+	for(uint8_t i{0}; i < _mpbsCnt; ++i){
+		for(uint8_t j{0}; j < _mpbsArr[i]->getSbscrbrsCnt(); ++j){
+			sbscrbrIdx = getMpbIdx(_mpbsArr[i]->getSbscrbr(j));
+			if(sbscrbrIdx != 0xFF)
+				++pndngPblshrs[sbscrbrIdx];
+		}
+	}
+	while(plcdCnt < _mpbsCnt){
+		plcdFnd = false;
+		for(uint8_t i{0}; i < _mpbsCnt; ++i){
+			if(!isPlcd[i] && (pndngPblshrs[i] == 0)){
+				_evalOrdr[plcdCnt++] = i;
+				isPlcd[i] = true;
+				for(uint8_t j{0}; j < _mpbsArr[i]->getSbscrbrsCnt(); ++j){
+					sbscrbrIdx = getMpbIdx(_mpbsArr[i]->getSbscrbr(j));
+					if(sbscrbrIdx != 0xFF)
+						--pndngPblshrs[sbscrbrIdx];
+				}
+				plcdFnd = true;
+				break;
+			}
+		}
+		if(!plcdFnd){	//Dependencies cycle, the rest of the objects are placed in registration order
+			_dpndncsCycl = true;
+			for(uint8_t i{0}; i < _mpbsCnt; ++i){
+				if(!isPlcd[i]){
+					_evalOrdr[plcdCnt++] = i;
+					isPlcd[i] = true;
+				}
+			}
+		}
+	}
+	_evalOrdrSbscrptnsVer = DbncdMPBttn::getSbscrptnsVer();
+	_evalOrdrVld = true;
+	mpbCrtclSctnExit();
+
+	return;
+}
+
+bool MpbGrp::unbindOtpt(gpioPinId_t otptPin){
+	bool result {false};
+
+	mpbCrtclSctnEnter();
+	for(uint8_t i{0}; i < _otptBndngsCnt; ++i){
+		if((_otptBndngsArr[i].port == otptPin.portId) && (_otptBndngsArr[i].pin == otptPin.pinNum)){
+			for(uint8_t j{i}; j < (_otptBndngsCnt - 1); ++j)
+				_otptBndngsArr[j] = _otptBndngsArr[j + 1];
+			--_otptBndngsCnt;
+			result = true;
+			break;
+		}
+	}
+	mpbCrtclSctnExit();
+
+	return result;
+}
+
+void MpbGrp::updateAll(const unsigned long int &curTm){
+	_updMpbs(curTm);
+	if(_otptBndngsCnt > 0)
+		wrtOtpts();
+
+	return;
+}
+
+void MpbGrp::_updMpbs(const unsigned long int &curTm, const bool &dfrNtf){
+	DbncdMPBttn* curMpb {nullptr};
+
+	if(_inptSrcsCnt > 0)
+		scanInptSrcs(curTm);
+	for(uint8_t i{0}; i < _mpbsCnt; ++i){
+		curMpb = getEvalMpb(i);
+		if(curMpb != nullptr)
+			curMpb->update(curTm, dfrNtf);
+	}
+
+	return;
+}
+
+void MpbGrp::wrtOtpts(){
+	bool isDone[_MpbGrpMaxOtptBndngs]{};
+	GPIO_TypeDef* curPort {nullptr};
+	uint16_t setMsk {0};
+	uint16_t rstMsk {0};
+	bool flagVal {false};
+
+	mpbCrtclSctnEnter();
+	for(uint8_t i{0}; i < _otptBndngsCnt; ++i){
+		if(!isDone[i]){	//Masks are built for all the bindings of the port, then written in a single BSRR access: set bits in the low half word, reset bits in the high half word
+			curPort = _otptBndngsArr[i].port;
+			setMsk = 0;
+			rstMsk = 0;
+			for(uint8_t j{i}; j < _otptBndngsCnt; ++j){
+				if(_otptBndngsArr[j].port == curPort){
+					flagVal = ((_otptBndngsArr[j].mpb->getOtptsSttsPkgd() >> _otptBndngsArr[j].otptBitPos) & 1) != 0;
+					if(flagVal == _otptBndngsArr[j].actvHigh)
+						setMsk |= _otptBndngsArr[j].pin;
+					else
+						rstMsk |= _otptBndngsArr[j].pin;
+					isDone[j] = true;
+				}
+			}
+			curPort->BSRR = (((uint32_t)rstMsk) << 16) | setMsk;
+		}
+	}
+	mpbCrtclSctnExit();
+
+	return;
+}
+
+//=========================================================================> Class methods delimiter
+
+MpbRdGrp::MpbRdGrp()
+{
+}
+
+MpbRdGrp::~MpbRdGrp()
+{
+}
+
+bool MpbRdGrp::addRdMpb(LtchMPBttn* newMpb){
+	bool result {false};
+
+	if(newMpb != nullptr){
+		mpbCrtclSctnEnter();
+		if((_rdMpbsCnt < _MpbRdGrpMaxSize) && addMpb(newMpb)){
+			_rdMpbsArr[_rdMpbsCnt] = newMpb;
+			if(newMpb->getIsOn() || newMpb->getIsLatched()){
+				if(_slctdIdx == 0xFF){
+					_slctdIdx = _rdMpbsCnt;
+				}
+				else{
+					newMpb->resetFda();
+				}
+			}
+			++_rdMpbsCnt;
+			result = true;
+		}
+		mpbCrtclSctnExit();
+	}
+
+	return result;
+}
+
+fncOtptsChngPtrType MpbRdGrp::getFnWhnSlctnChng(){
+
+	return _fnWhnSlctnChng;
+}
+
+const uint8_t MpbRdGrp::getRdMpbsCnt() const{
+
+	return _rdMpbsCnt;
+}
+
+LtchMPBttn* MpbRdGrp::getRdMpb(const uint8_t &rdIdx){
+	LtchMPBttn* result {nullptr};
+
+	if(rdIdx < _rdMpbsCnt)
+		result = _rdMpbsArr[rdIdx];
+
+	return result;
+}
+
+LtchMPBttn* MpbRdGrp::getSlctd(){
+
+	return getRdMpb(_slctdIdx);
+}
+
+const uint8_t MpbRdGrp::getSlctdIdx() const{
+
+	return _slctdIdx;
+}
+
+#ifndef MPB_BARE_METAL
+const TaskHandle_t MpbRdGrp::getTaskToNotify() const{
+
+	return _taskToNotifyHndl;
+}
+#endif
+
+void MpbRdGrp::_notifySlctnChng(){
+	if(_fnWhnSlctnChng != nullptr)
+		_fnWhnSlctnChng(_slctdIdx);
+#ifndef MPB_BARE_METAL
+	if(_taskToNotifyHndl != NULL){
+		if(xPortIsInsideInterrupt()){	//Polling from a hardware timer ISR, the ISR safe API version must be used
+			BaseType_t xHigherPriorityTaskWoken {pdFALSE};
+
+			xTaskNotifyFromISR(_taskToNotifyHndl, static_cast<unsigned long>(_slctdIdx), eSetValueWithOverwrite, &xHigherPriorityTaskWoken);
+			portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+		}
+		else{
+			xTaskNotify(_taskToNotifyHndl, static_cast<unsigned long>(_slctdIdx), eSetValueWithOverwrite);
+		}
+	}
+#endif
+
+	return;
+}
+
+bool MpbRdGrp::rmvMpb(DbncdMPBttn* mpb){
+	bool result {false};
+
+	mpbCrtclSctnEnter();
+	result = MpbGrp::rmvMpb(mpb);
+	if(result){
+		for(uint8_t i{0}; i < _rdMpbsCnt; ++i){
+			if(_rdMpbsArr[i] == mpb){
+				for(uint8_t j{i}; j < (_rdMpbsCnt - 1); ++j)
+					_rdMpbsArr[j] = _rdMpbsArr[j + 1];
+				--_rdMpbsCnt;
+				_rdMpbsArr[_rdMpbsCnt] = nullptr;
+				if(_slctdIdx == i)
+					_slctdIdx = 0xFF;
+				else if((_slctdIdx != 0xFF) && (_slctdIdx > i))
+					--_slctdIdx;
+				break;
+			}
+		}
+	}
+	mpbCrtclSctnExit();
+
+	return result;
+}
+
+void MpbRdGrp::setFnWhnSlctnChng(fncOtptsChngPtrType newFnWhnSlctnChng){
+	mpbCrtclSctnEnter();
+	if(_fnWhnSlctnChng != newFnWhnSlctnChng)
+		_fnWhnSlctnChng = newFnWhnSlctnChng;
+	mpbCrtclSctnExit();
+
+	return;
+}
+
+#ifndef MPB_BARE_METAL
+void MpbRdGrp::setTaskToNotify(const TaskHandle_t &newTaskHandle){
+	mpbCrtclSctnEnter();
+	if(_taskToNotifyHndl != newTaskHandle)
+		_taskToNotifyHndl = newTaskHandle;
+	mpbCrtclSctnExit();
+
+	return;
+}
+#endif
+
+void MpbRdGrp::updateAll(const unsigned long int &curTm){
+	bool slctnChng {false};
+	DbncdMPBttn* curMpb {nullptr};
+
+	_updMpbs(curTm, true);	//The members are updated with their own short critical sections, their notifications deferred until the exclusivity is enforced
+	mpbCrtclSctnEnter();	//Only the exclusivity enforcement -a few flags checks and the siblings resets- is an atomic step
+	slctnChng = _updSlctn();
+	mpbCrtclSctnExit();
+	if(_otptBndngsCnt > 0)
+		wrtOtpts();	//Written after the siblings resets, no bound output ever shows two members selected
+	for(uint8_t i{0}; i < _mpbsCnt; ++i){	//The new member On change and the siblings Off changes are delivered in this same cycle
+		curMpb = getEvalMpb(i);
+		if(curMpb != nullptr)
+			curMpb->flshOtptsChng();
+	}
+	if(slctnChng)
+		_notifySlctnChng();
+
+	return;
+}
+
+bool MpbRdGrp::_updSlctn(){
+	uint8_t newIdx {0xFF};
+	bool result {false};
+
+	if((_slctdIdx != 0xFF) && !_rdMpbsArr[_slctdIdx]->getIsOn()){	//The selected member was turned off by itself
+		_slctdIdx = 0xFF;
+		result = true;
+	}
+	for(uint8_t i{0}; i < _rdMpbsCnt; ++i){
+		if((i != _slctdIdx) && _rdMpbsArr[i]->getIsOn()){
+			newIdx = i;
+			break;
+		}
+	}
+	if(newIdx != 0xFF){	//A new member was selected, the rest are unlatched and turned off in this same cycle
+		for(uint8_t i{0}; i < _rdMpbsCnt; ++i){
+			if((i != newIdx) && (_rdMpbsArr[i]->getIsOn() || _rdMpbsArr[i]->getIsLatched())){
+				_rdMpbsArr[i]->resetFda();
+			}
+		}
+		_slctdIdx = newIdx;
+		result = true;
+	}
+
+	return result;
+}
+
+//=========================================================================> Class methods delimiter
+
+MpbSchdlr::MpbSchdlr(const unsigned long int &tckMs)
+:_tckMs{tckMs}
+{
+	if(_tckMs == 0)
+		_tckMs = 1;
+}
+
+MpbSchdlr::~MpbSchdlr(){
+#ifndef MPB_BARE_METAL
+	end();
+#endif
+}
+
+bool MpbSchdlr::addInptSrc(MpbInptSrc* newInptSrc, const unsigned long int &pollPrdMs){
+	bool result {false};
+	uint16_t prdTcks {static_cast<uint16_t>((pollPrdMs + (_tckMs / 2)) / _tckMs)};
+
+	if(prdTcks == 0)
+		prdTcks = 1;
+	mpbCrtclSctnEnter();
+	for(uint8_t clssIdx{0}; clssIdx < _clssCnt; ++clssIdx){
+		if(_clssPrdTcks[clssIdx] == prdTcks){
+			result = _clssGrps[clssIdx].addInptSrc(newInptSrc);
+			break;
+		}
+	}
+	mpbCrtclSctnExit();
+
+	return result;
+}
+
+bool MpbSchdlr::addMpb(DbncdMPBttn* newMpb, const unsigned long int &pollPrdMs){
+	bool result {false};
+	uint16_t prdTcks {static_cast<uint16_t>((pollPrdMs + (_tckMs / 2)) / _tckMs)};
+	uint8_t clssIdx {0};
+
+	if(prdTcks == 0)
+		prdTcks = 1;
+	if(newMpb != nullptr){
+		mpbCrtclSctnEnter();
+		for(uint8_t i{0}; i < _clssCnt; ++i){
+			if(_clssGrps[i].getMpbIdx(newMpb) != 0xFF){	//Already registered
+				clssIdx = 0xFF;
+				break;
+			}
+		}
+		if(clssIdx != 0xFF){
+			while((clssIdx < _clssCnt) && (_clssPrdTcks[clssIdx] < prdTcks))
+				++clssIdx;
+			if((clssIdx == _clssCnt) || (_clssPrdTcks[clssIdx] != prdTcks)){	//A new class is needed, inserted keeping the classes ordered by period
+				if(_clssCnt < _MpbSchdlrMaxClss){
+					for(uint8_t i{_clssCnt}; i > clssIdx; --i){
+						_clssGrps[i] = _clssGrps[i - 1];
+						_clssPrdTcks[i] = _clssPrdTcks[i - 1];
+					}
+					_clssGrps[clssIdx] = MpbGrp();
+					_clssPrdTcks[clssIdx] = prdTcks;
+					++_clssCnt;
+				}
+				else{
+					clssIdx = 0xFF;
+				}
+			}
+			if(clssIdx != 0xFF)
+				result = _clssGrps[clssIdx].addMpb(newMpb);
+			if(result)
+				_sltsVld = false;
+		}
+		mpbCrtclSctnExit();
+	}
+
+	return result;
+}
+
+bool MpbSchdlr::bindOtpt(DbncdMPBttn* mpb, const uint8_t &otptBitPos, gpioPinId_t otptPin, const bool &actvHigh){
+	bool result {false};
+
+	for(uint8_t clssIdx{0}; clssIdx < _clssCnt; ++clssIdx){
+		if(_clssGrps[clssIdx].getMpbIdx(mpb) != 0xFF){
+			result = _clssGrps[clssIdx].bindOtpt(mpb, otptBitPos, otptPin, actvHigh);
+			break;
+		}
+	}
+
+	return result;
+}
+
+void MpbSchdlr::_bldSlts(){
+	//Each class objects are grouped in dependency chains -objects linked by subscriptions-, each chain is assigned as a whole to the least loaded slot. The slots are listed in the class evaluation order, so each publisher is polled before it's subscribers
+	uint8_t chnOf[_MpbGrpMaxSize]{};
+	uint8_t chnSz[_MpbGrpMaxSize]{};
+	uint8_t sltOf[_MpbGrpMaxSize]{};
+	uint8_t sltLd[_MpbGrpMaxSize]{};
+	uint8_t mpbsCnt {0};
+	uint8_t sltsMax {0};
+	uint8_t sbscrbrPos {0};
+	uint8_t oldChn {0};
+	uint8_t newChn {0};
+	DbncdMPBttn* curMpb {nullptr};
+
+	mpbCrtclSctnEnter();
+	for(uint8_t clssIdx{0}; clssIdx < _clssCnt; ++clssIdx){
+		mpbsCnt = _clssGrps[clssIdx].getMpbsCnt();
+		sltsMax = (_clssPrdTcks[clssIdx] < mpbsCnt)?_clssPrdTcks[clssIdx]:mpbsCnt;
+		for(uint8_t pos{0}; pos < mpbsCnt; ++pos){
+			chnOf[pos] = pos;
+			chnSz[pos] = 0;
+		}
+		for(uint8_t pos{0}; pos < mpbsCnt; ++pos){	//The chains are merged keeping the lowest evaluation position as their identifier
+			curMpb = _clssGrps[clssIdx].getEvalMpb(pos);
+			for(uint8_t j{0}; j < curMpb->getSbscrbrsCnt(); ++j){
+				for(sbscrbrPos = 0; (sbscrbrPos < mpbsCnt) && (_clssGrps[clssIdx].getEvalMpb(sbscrbrPos) != curMpb->getSbscrbr(j)); ++sbscrbrPos);
+				if((sbscrbrPos < mpbsCnt) && (chnOf[sbscrbrPos] != chnOf[pos])){
+					oldChn = (chnOf[sbscrbrPos] > chnOf[pos])?chnOf[sbscrbrPos]:chnOf[pos];
+					newChn = (chnOf[sbscrbrPos] > chnOf[pos])?chnOf[pos]:chnOf[sbscrbrPos];
+					for(uint8_t k{0}; k < mpbsCnt; ++k){
+						if(chnOf[k] == oldChn)
+							chnOf[k] = newChn;
+					}
+				}
+			}
+		}
+		for(uint8_t pos{0}; pos < mpbsCnt; ++pos){
+			++chnSz[chnOf[pos]];
+			sltLd[pos] = 0;
+		}
+		for(uint8_t pos{0}; pos < mpbsCnt; ++pos){	//A chain's first object is met before the rest of it's objects
+			if(chnOf[pos] == pos){
+				sltOf[pos] = 0;
+				for(uint8_t slt{1}; slt < sltsMax; ++slt){
+					if(sltLd[slt] < sltLd[sltOf[pos]])
+						sltOf[pos] = slt;
+				}
+				sltLd[sltOf[pos]] += chnSz[pos];
+			}
+			else{
+				sltOf[pos] = sltOf[chnOf[pos]];
+			}
+		}
+		_clssSltsCnt[clssIdx] = 0;	//The least loaded slot choice fills the empty slots first, so the used slots are the lowest ones
+		_clssSltsStrt[clssIdx][0] = 0;
+		for(uint8_t slt{0}; slt < sltsMax; ++slt){
+			if(sltLd[slt] > 0)
+				_clssSltsCnt[clssIdx] = slt + 1;
+			_clssSltsStrt[clssIdx][slt + 1] = _clssSltsStrt[clssIdx][slt] + sltLd[slt];
+			sltLd[slt] = _clssSltsStrt[clssIdx][slt];	//Reused as the slot's next free position
+		}
+		for(uint8_t pos{0}; pos < mpbsCnt; ++pos)
+			_clssSltsOrdr[clssIdx][sltLd[sltOf[pos]]++] = pos;
+	}
+	_sltsSbscrptnsVer = DbncdMPBttn::getSbscrptnsVer();
+	_sltsVld = true;
+	mpbCrtclSctnExit();
+
+	return;
+}
+
+#ifndef MPB_BARE_METAL
+bool MpbSchdlr::begin(){
+	bool result {false};
+	BaseType_t tmrModResult {pdFAIL};
+	TickType_t tckPrd {pdMS_TO_TICKS(_tckMs)};
+
+	if(tckPrd == 0)	//A base tick shorter than the RTOS tick converts to 0 ticks, rejected by xTimerCreate()
+		tckPrd = 1;
+	if (!_schdlrTmrHndl){
+		_schdlrTmrHndl = xTimerCreate(
+			"MpbSchdlr_tmr",  //Timer name
+			tckPrd,  //Timer period in ticks
+			pdTRUE,     //Auto-reload true
+			this,       //TimerID: data passed to the callback function to work
+			schdlrTmrCallback	  //Callback function
+		);
+		if (_schdlrTmrHndl != NULL){
+			tmrModResult = xTimerStart(_schdlrTmrHndl, portMAX_DELAY);
+			if (tmrModResult == pdPASS)
+				result = true;
+		}
+	}
+
+	return result;
+}
+
+bool MpbSchdlr::end(){
+	bool result {false};
+	BaseType_t tmrModResult {pdFAIL};
+
+	if (_schdlrTmrHndl){
+		tmrModResult = xTimerDelete(_schdlrTmrHndl, portMAX_DELAY);
+		if (tmrModResult == pdPASS){
+			_schdlrTmrHndl = NULL;
+			result = true;
+		}
+	}
+
+	return result;
+}
+#endif
+
+const uint8_t MpbSchdlr::getClssCnt() const{
+
+	return _clssCnt;
+}
+
+unsigned long int MpbSchdlr::getClssPrd(const uint8_t &clssIdx){
+	unsigned long int result {0};
+
+	if(clssIdx < _clssCnt)
+		result = _clssPrdTcks[clssIdx] * _tckMs;
+
+	return result;
+}
+
+bool MpbSchdlr::rmvMpb(DbncdMPBttn* mpb){
+	bool result {false};
+
+	mpbCrtclSctnEnter();
+	for(uint8_t clssIdx{0}; clssIdx < _clssCnt; ++clssIdx){
+		if(_clssGrps[clssIdx].rmvMpb(mpb)){
+			if(_clssGrps[clssIdx].getMpbsCnt() == 0){	//The class is left empty, it's removed
+				for(uint8_t i{clssIdx}; i < (_clssCnt - 1); ++i){
+					_clssGrps[i] = _clssGrps[i + 1];
+					_clssPrdTcks[i] = _clssPrdTcks[i + 1];
+				}
+				--_clssCnt;
+				_clssGrps[_clssCnt] = MpbGrp();
+				_clssPrdTcks[_clssCnt] = 0;
+			}
+			_sltsVld = false;
+			result = true;
+			break;
+		}
+	}
+	mpbCrtclSctnExit();
+
+	return result;
+}
+
+#ifndef MPB_BARE_METAL
+void MpbSchdlr::schdlrTmrCallback(TimerHandle_t schdlrTmrCbArg){
+	MpbSchdlr* schdlrObj = (MpbSchdlr*)pvTimerGetTimerID(schdlrTmrCbArg);
+
+	schdlrObj->tick(xTaskGetTickCount() / portTICK_RATE_MS);
+
+	return;
+}
+#endif
+
+void MpbSchdlr::tick(const unsigned long int &curTm){
+	DbncdMPBttn* curMpb {nullptr};
+	uint32_t curSlt {0};
+
+	if(!_sltsVld || (_sltsSbscrptnsVer != DbncdMPBttn::getSbscrptnsVer()))
+		_bldSlts();
+	for(uint8_t clssIdx{0}; clssIdx < _clssCnt; ++clssIdx){	//Classes are ordered by period, faster classes are polled first
+		curSlt = _tcksCnt % _clssPrdTcks[clssIdx];
+		if((_clssGrps[clssIdx].getInptSrcsCnt() > 0) && (_clssGrps[clssIdx].getMpbsCnt() > 0) && (curSlt == 0))	//Input sources are refreshed once per class period, in the first slot tick, the objects of all the slots reading that image
+			_clssGrps[clssIdx].scanInptSrcs(curTm);
+		if(curSlt < _clssSltsCnt[clssIdx]){	//Only the objects in the current slot of the class are polled
+			for(uint8_t i{_clssSltsStrt[clssIdx][curSlt]}; i < _clssSltsStrt[clssIdx][curSlt + 1]; ++i){
+				curMpb = _clssGrps[clssIdx].getEvalMpb(_clssSltsOrdr[clssIdx][i]);
+				if(curMpb != nullptr)
+					curMpb->update(curTm);
+			}
+			if(_clssGrps[clssIdx].getOtptBndngsCnt() > 0)	//Bound outputs are written only in the ticks the class objects were updated
+				_clssGrps[clssIdx].wrtOtpts();
+		}
+	}
+	++_tcksCnt;
+
+	return;
+}
+
+//=========================================================================> Class methods delimiter
+
+MpbPollSrc::MpbPollSrc(MpbGrp* mpbGrp, const uint32_t &pollPrdUs)
+:_mpbGrp{mpbGrp}, _pollPrdUs{pollPrdUs}
+{
+}
+
+MpbPollSrc::~MpbPollSrc()
+{
+}
+
+void MpbPollSrc::clrStats(){
+	mpbCrtclSctnEnter();
+	_exctnMax = 0;
+	_ltncyMax = 0;
+	_ltncyMin = 0xFFFFFFFF;
+	_pollsCnt = 0;
+	mpbCrtclSctnExit();
+
+	return;
+}
+
+const unsigned long int MpbPollSrc::getCurTm() const{
+
+	return _curTm;
+}
+
+uint32_t MpbPollSrc::_getCntrVal(){
+
+	return 0;
+}
+
+const uint32_t MpbPollSrc::getExctnMax() const{
+
+	return _exctnMax;
+}
+
+const uint32_t MpbPollSrc::getLtncyMax() const{
+
+	return _ltncyMax;
+}
+
+const uint32_t MpbPollSrc::getLtncyMin() const{
+
+	return _ltncyMin;
+}
+
+const uint32_t MpbPollSrc::getPollsCnt() const{
+
+	return _pollsCnt;
+}
+
+void MpbPollSrc::pollIsr(){
+	uint32_t pollStrt {_getCntrVal()};	//The counter restarts at the period start, so the value read is the latency
+	uint32_t pollExctn {0};
+
+	_tmRmndrUs += _pollPrdUs;
+	_curTm += _tmRmndrUs / 1000;
+	_tmRmndrUs %= 1000;
+	if(_mpbGrp != nullptr)
+		_mpbGrp->updateAll(_curTm);
+
+	pollExctn = _getCntrVal() - pollStrt;
+	if(pollStrt > _ltncyMax)
+		_ltncyMax = pollStrt;
+	if(pollStrt < _ltncyMin)
+		_ltncyMin = pollStrt;
+	if(pollExctn > _exctnMax)
+		_exctnMax = pollExctn;
+	++_pollsCnt;
+
+	return;
+}
+
+//=========================================================================> Class methods delimiter
+
+#ifdef HAL_TIM_MODULE_ENABLED
+MpbHalTmrPollSrc::MpbHalTmrPollSrc(MpbGrp* mpbGrp, TIM_HandleTypeDef* htim, const uint32_t &pollPrdUs)
+:MpbPollSrc(mpbGrp, pollPrdUs), _htim{htim}
+{
+}
+
+MpbHalTmrPollSrc::~MpbHalTmrPollSrc(){
+	end();
+}
+
+bool MpbHalTmrPollSrc::begin(){
+	bool result {false};
+
+	if(_htim != nullptr)
+		result = (HAL_TIM_Base_Start_IT(_htim) == HAL_OK);
+
+	return result;
+}
+
+bool MpbHalTmrPollSrc::end(){
+	bool result {false};
+
+	if(_htim != nullptr)
+		result = (HAL_TIM_Base_Stop_IT(_htim) == HAL_OK);
+
+	return result;
+}
+
+uint32_t MpbHalTmrPollSrc::_getCntrVal(){
+
+	return __HAL_TIM_GET_COUNTER(_htim);
+}
+
+TIM_HandleTypeDef* MpbHalTmrPollSrc::getTim(){
+
+	return _htim;
+}
+#endif
+
+//=========================================================================> Class methods delimiter
+
+MpbHostPollSrc::MpbHostPollSrc(MpbGrp* mpbGrp, const uint32_t &pollPrdUs)
+:MpbPollSrc(mpbGrp, pollPrdUs)
+{
+}
+
+MpbHostPollSrc::~MpbHostPollSrc()
+{
+}
+
+bool MpbHostPollSrc::begin(){
+	_isRunning = true;
+
+	return _isRunning;
+}
+
+bool MpbHostPollSrc::end(){
+	_isRunning = false;
+
+	return true;
+}
+
+uint32_t MpbHostPollSrc::_getCntrVal(){
+
+	return _simLtncy;
+}
+
+void MpbHostPollSrc::run(const uint32_t &durationUs){
+	if(_isRunning && (_pollPrdUs > 0)){
+		_simRmndrUs += durationUs;
+		while(_simRmndrUs >= _pollPrdUs){
+			_simRmndrUs -= _pollPrdUs;
+			pollIsr();
+		}
+	}
+
+	return;
+}
+
+void MpbHostPollSrc::setSimLtncy(const uint32_t &newSimLtncy){
+	if(_simLtncy != newSimLtncy)
+		_simLtncy = newSimLtncy;
+
+	return;
+}
+
+//=========================================================================> Class methods delimiter
+
+MpbInptSrc::MpbInptSrc(const uint16_t &inptsCnt)
+:_inptsCnt{inptsCnt}
+{
+}
+
+MpbInptSrc::~MpbInptSrc()
+{
+}
+
+const uint16_t MpbInptSrc::getInptsCnt() const{
+
+	return _inptsCnt;
+}
+
+const uint32_t MpbInptSrc::getScnsCnt() const{
+
+	return _scnsCnt;
+}
+
+//=========================================================================> Class methods delimiter
+
+MpbMtrxInptSrc::MpbMtrxInptSrc(gpioPinId_t* rowsPins, const uint8_t &rowsCnt, gpioPinId_t* colsPins, const uint8_t &colsCnt)
+:MpbInptSrc(0)
+{
+	if((rowsPins != nullptr) && (colsPins != nullptr) && (rowsCnt > 0) && (colsCnt > 0) && (rowsCnt <= _MpbMtrxMaxLines) && (colsCnt <= _MpbMtrxMaxLines) && ((rowsCnt * colsCnt) <= _MpbMtrxMaxKeys)){
+		GPIO_InitTypeDef GPIO_InitStruct {0};
+		uint8_t portIdx {0};
+
+		_rowsCnt = rowsCnt;
+		_colsCnt = colsCnt;
+		_inptsCnt = _rowsCnt * _colsCnt;
+		/*Configure the rows pins: open drain outputs, released (high level) before being enabled as outputs*/
+		GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_OD;
+		GPIO_InitStruct.Pull = GPIO_NOPULL;
+		GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
+		for(uint8_t i{0}; i < _rowsCnt; ++i){
+			_rowsPins[i] = rowsPins[i];
+			HAL_GPIO_WritePin(_rowsPins[i].portId, _rowsPins[i].pinNum, GPIO_PIN_SET);
+			GPIO_InitStruct.Pin = _rowsPins[i].pinNum;
+			HAL_GPIO_Init(_rowsPins[i].portId, &GPIO_InitStruct);
+		}
+		/*Configure the columns pins: pulled up inputs. The distinct columns ports are listed, to read each port once per row*/
+		GPIO_InitStruct.Mode = GPIO_MODE_INPUT;
+		GPIO_InitStruct.Pull = GPIO_PULLUP;
+		for(uint8_t i{0}; i < _colsCnt; ++i){
+			_colsPins[i] = colsPins[i];
+			GPIO_InitStruct.Pin = _colsPins[i].pinNum;
+			HAL_GPIO_Init(_colsPins[i].portId, &GPIO_InitStruct);
+			portIdx = 0;
+			while((portIdx < _colsPortsCnt) && (_colsPorts[portIdx] != _colsPins[i].portId))
+				++portIdx;
+			if(portIdx == _colsPortsCnt){
+				_colsPorts[_colsPortsCnt] = _colsPins[i].portId;
+				++_colsPortsCnt;
+			}
+			_colsPortIdx[i] = portIdx;
+		}
+	}
+}
+
+MpbMtrxInptSrc::~MpbMtrxInptSrc()
+{
+}
+
+const uint8_t MpbMtrxInptSrc::getColsCnt() const{
+
+	return _colsCnt;
+}
+
+const bool MpbMtrxInptSrc::getGhstDtctn() const{
+
+	return _ghstDtctn;
+}
+
+const bool MpbMtrxInptSrc::getGhstd() const{
+
+	return _ghstd;
+}
+
+const uint32_t MpbMtrxInptSrc::getGhstsCnt() const{
+
+	return _ghstsCnt;
+}
+
+bool MpbMtrxInptSrc::getInptSt(const uint16_t &inptIdx){
+	bool result {false};
+
+	if(inptIdx < _inptsCnt)
+		result = ((_keysBtmp[inptIdx / 32] >> (inptIdx % 32)) & 1) != 0;
+
+	return result;
+}
+
+uint16_t MpbMtrxInptSrc::getKeyIdx(const uint8_t &row, const uint8_t &col){
+	uint16_t result {0xFFFF};
+
+	if((row < _rowsCnt) && (col < _colsCnt))
+		result = (row * _colsCnt) + col;
+
+	return result;
+}
+
+void MpbMtrxInptSrc::getKeysBtmp(uint32_t* keysBtmp){
+	if(keysBtmp != nullptr){
+		mpbCrtclSctnEnter();
+		for(uint8_t i{0}; i < ((_inptsCnt + 31) / 32); ++i)
+			keysBtmp[i] = _keysBtmp[i];
+		mpbCrtclSctnExit();
+	}
+
+	return;
+}
+
+const uint8_t MpbMtrxInptSrc::getRowsCnt() const{
+
+	return _rowsCnt;
+}
+
+void MpbMtrxInptSrc::scan(const unsigned long int &curTm){
+	uint16_t rowsCols[_MpbMtrxMaxLines]{};	//Pressed columns mask of each row
+	uint16_t ghstCols[_MpbMtrxMaxLines]{};	//Columns of each row whose keys state can't be read reliably
+	uint32_t portsIdr[_MpbMtrxMaxLines]{};
+	uint16_t cmnCols {0};
+	uint16_t keyIdx {0};
+	bool ghstd {false};
+
+	(void)curTm;
+	for(uint8_t row{0}; row < _rowsCnt; ++row){
+		_rowsPins[row].portId->BSRR = ((uint32_t)_rowsPins[row].pinNum) << 16;	//Row driven to low level
+		for(uint8_t i{0}; i < _sttlRds; ++i)
+			portsIdr[0] = _colsPorts[0]->IDR;
+		for(uint8_t i{0}; i < _colsPortsCnt; ++i)
+			portsIdr[i] = _colsPorts[i]->IDR;
+		_rowsPins[row].portId->BSRR = _rowsPins[row].pinNum;	//Row released
+		for(uint8_t col{0}; col < _colsCnt; ++col){
+			if((portsIdr[_colsPortIdx[col]] & _colsPins[col].pinNum) == 0)
+				rowsCols[row] |= (1 << col);
+		}
+	}
+	if(_ghstDtctn){	//Two rows sharing two or more pressed columns build a rectangle with at least three pressed keys, any of it's four keys might be a ghost
+		for(uint8_t row{0}; row < _rowsCnt; ++row){
+			for(uint8_t othrRow{static_cast<uint8_t>(row + 1)}; othrRow < _rowsCnt; ++othrRow){
+				cmnCols = rowsCols[row] & rowsCols[othrRow];
+				if((cmnCols & (cmnCols - 1)) != 0){
+					ghstCols[row] |= cmnCols;
+					ghstCols[othrRow] |= cmnCols;
+					ghstd = true;
+				}
+			}
+		}
+	}
+	mpbCrtclSctnEnter();
+	for(uint8_t row{0}; row < _rowsCnt; ++row){
+		for(uint8_t col{0}; col < _colsCnt; ++col){
+			if((ghstCols[row] & (1 << col)) == 0){	//Ghosting keys keep their previous state
+				if((rowsCols[row] & (1 << col)) != 0)
+					_keysBtmp[keyIdx / 32] |= (1UL << (keyIdx % 32));
+				else
+					_keysBtmp[keyIdx / 32] &= ~(1UL << (keyIdx % 32));
+			}
+			++keyIdx;
+		}
+	}
+	_ghstd = ghstd;
+	if(ghstd)
+		++_ghstsCnt;
+	++_scnsCnt;
+	mpbCrtclSctnExit();
+
+	return;
+}
+
+void MpbMtrxInptSrc::setGhstDtctn(const bool &newGhstDtctn){
+	mpbCrtclSctnEnter();
+	if(_ghstDtctn != newGhstDtctn)
+		_ghstDtctn = newGhstDtctn;
+	mpbCrtclSctnExit();
+
+	return;
+}
+
+void MpbMtrxInptSrc::setSttlRds(const uint8_t &newSttlRds){
+	mpbCrtclSctnEnter();
+	if(_sttlRds != newSttlRds)
+		_sttlRds = newSttlRds;
+	mpbCrtclSctnExit();
+
+	return;
+}
+
+//=========================================================================> Class methods delimiter
+
+MpbGpioPortInptSrc::MpbGpioPortInptSrc(GPIO_TypeDef* port, const uint16_t &pinsMsk, const bool &pulledUp)
+:MpbInptSrc(0), _pinsMsk{pinsMsk}, _port{port}, _pulledUp{pulledUp}
+{
+	if((_port != nullptr) && (_pinsMsk != 0)){
+		/*Configure the input pins*/
+		GPIO_InitTypeDef GPIO_InitStruct {0};
+
+		GPIO_InitStruct.Pin = _pinsMsk;
+		GPIO_InitStruct.Mode = GPIO_MODE_INPUT;
+		GPIO_InitStruct.Pull = (_pulledUp)?GPIO_PULLUP:GPIO_PULLDOWN;
+		HAL_GPIO_Init(_port, &GPIO_InitStruct);
+		_inptsCnt = 16;
+	}
+}
+
+MpbGpioPortInptSrc::~MpbGpioPortInptSrc()
+{
+}
+
+bool MpbGpioPortInptSrc::getInptSt(const uint16_t &inptIdx){
+	bool result {false};
+
+	if(inptIdx < _inptsCnt)
+		result = ((_portImg >> inptIdx) & 1) != 0;
+
+	return result;
+}
+
+const uint16_t MpbGpioPortInptSrc::getPinsMsk() const{
+
+	return _pinsMsk;
+}
+
+void MpbGpioPortInptSrc::scan(const unsigned long int &curTm){
+	uint16_t portVal {0};
+
+	(void)curTm;
+	if(_inptsCnt > 0){
+		portVal = static_cast<uint16_t>(_port->IDR);
+		_portImg = ((_pulledUp)?(uint16_t)(~portVal):portVal) & _pinsMsk;	//Image of the active inputs
+		++_scnsCnt;
+	}
+
+	return;
+}
+
+//=========================================================================> Class methods delimiter
+
+MpbSwInptSrc::MpbSwInptSrc(const uint16_t &inptsCnt)
+:MpbInptSrc((inptsCnt <= _MpbSwInptsMaxQty)?inptsCnt:0)
+{
+}
+
+MpbSwInptSrc::~MpbSwInptSrc()
+{
+}
+
+bool MpbSwInptSrc::getInptSt(const uint16_t &inptIdx){
+	bool result {false};
+
+	if(inptIdx < _inptsCnt)
+		result = (_swInpts[inptIdx] != 0);
+
+	return result;
+}
+
+void MpbSwInptSrc::scan(const unsigned long int &curTm){
+	(void)curTm;
+	++_scnsCnt;
+
+	return;
+}
+
+bool MpbSwInptSrc::setInptSt(const uint16_t &inptIdx, const bool &newInptSt){
+	bool result {false};
+
+	if(inptIdx < _inptsCnt){
+		_swInpts[inptIdx] = (newInptSt)?1:0;	//Single byte store, atomic with no lock needed
+		result = true;
+	}
+
+	return result;
+}
+
+MpbShftRgstrInptSrc::MpbShftRgstrInptSrc(const uint8_t &rgstrsCnt, const bool &actvLow)
+:MpbInptSrc(0), _actvLow{actvLow}
+{
+	if(rgstrsCnt <= _MpbShftRgstrMaxRgstrs){
+		_rgstrsCnt = rgstrsCnt;
+		_inptsCnt = _rgstrsCnt * 8;
+	}
+}
+
+MpbShftRgstrInptSrc::~MpbShftRgstrInptSrc()
+{
+}
+
+const bool MpbShftRgstrInptSrc::getAsyncRd() const{
+
+	return _asyncRd;
+}
+
+bool MpbShftRgstrInptSrc::getInptSt(const uint16_t &inptIdx){
+	bool result {false};
+
+	if(inptIdx < _inptsCnt)
+		result = ((_inptsBtmp[inptIdx / 32] >> (inptIdx % 32)) & 1) != 0;
+
+	return result;
+}
+
+void MpbShftRgstrInptSrc::getInptsBtmp(uint32_t* inptsBtmp){
+	if(inptsBtmp != nullptr){
+		mpbCrtclSctnEnter();
+		for(uint8_t i{0}; i < ((_inptsCnt + 31) / 32); ++i)
+			inptsBtmp[i] = _inptsBtmp[i];
+		mpbCrtclSctnExit();
+	}
+
+	return;
+}
+
+const uint32_t MpbShftRgstrInptSrc::getRdErrsCnt() const{
+
+	return _rdErrsCnt;
+}
+
+const uint8_t MpbShftRgstrInptSrc::getRgstrsCnt() const{
+
+	return _rgstrsCnt;
+}
+
+void MpbShftRgstrInptSrc::rxCpltIsr(){
+	if(_rxBsy){
+		_rxBsy = false;
+		_rxCmplt = true;
+	}
+
+	return;
+}
+
+void MpbShftRgstrInptSrc::rxErrIsr(){
+	if(_rxBsy){
+		_rxBsy = false;
+		++_rdErrsCnt;
+	}
+
+	return;
+}
+
+void MpbShftRgstrInptSrc::scan(const unsigned long int &curTm){
+	(void)curTm;
+	if(_rgstrsCnt > 0){
+		if(!_asyncRd){
+			if(_rdRgstrs(_rxBuf))
+				_updImg();
+			else
+				++_rdErrsCnt;
+		}
+		else{
+			if(_rxCmplt){
+				_rxCmplt = false;
+				_updImg();
+			}
+			if(!_rxBsy){	//The next read is started once the received data was used, so no double buffering is needed
+				_rxBsy = true;
+				if(!_strtRdRgstrs(_rxBuf)){
+					_rxBsy = false;
+					++_rdErrsCnt;
+				}
+			}
+		}
+		++_scnsCnt;
+	}
+
+	return;
+}
+
+void MpbShftRgstrInptSrc::setAsyncRd(const bool &newAsyncRd){
+	mpbCrtclSctnEnter();
+	if((_asyncRd != newAsyncRd) && (!_rxBsy)){
+		_asyncRd = newAsyncRd;
+		_rxCmplt = false;
+	}
+	mpbCrtclSctnExit();
+
+	return;
+}
+
+void MpbShftRgstrInptSrc::_updImg(){
+	uint32_t tmpBtmp[(_MpbShftRgstrMaxRgstrs * 8 + 31) / 32]{};
+	uint8_t rgstrVal {0};
+
+	for(uint8_t i{0}; i < _rgstrsCnt; ++i){
+		rgstrVal = (_actvLow)?(uint8_t)(~_rxBuf[i]):_rxBuf[i];
+		tmpBtmp[i / 4] |= ((uint32_t)rgstrVal) << ((i % 4) * 8);
+	}
+	mpbCrtclSctnEnter();
+	for(uint8_t i{0}; i < ((_inptsCnt + 31) / 32); ++i)
+		_inptsBtmp[i] = tmpBtmp[i];
+	mpbCrtclSctnExit();
+
+	return;
+}
+
+//=========================================================================> Class methods delimiter
+
+#ifdef HAL_SPI_MODULE_ENABLED
+MpbHalSpiShftRgstrInptSrc::MpbHalSpiShftRgstrInptSrc(SPI_HandleTypeDef* hspi, gpioPinId_t ldPin, const uint8_t &rgstrsCnt, const bool &actvLow)
+:MpbShftRgstrInptSrc(rgstrsCnt, actvLow), _hspi{hspi}, _ldPin{ldPin}
+{
+	if((_hspi != nullptr) && (_ldPin.portId != nullptr)){
+		/*Configure the shift/load pin: push-pull output, set to it's idle high level before being enabled as output*/
+		GPIO_InitTypeDef GPIO_InitStruct {0};
+
+		HAL_GPIO_WritePin(_ldPin.portId, _ldPin.pinNum, GPIO_PIN_SET);
+		GPIO_InitStruct.Pin = _ldPin.pinNum;
+		GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
+		GPIO_InitStruct.Pull = GPIO_NOPULL;
+		GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
+		HAL_GPIO_Init(_ldPin.portId, &GPIO_InitStruct);
+	}
+	else{
+		_rgstrsCnt = 0;
+		_inptsCnt = 0;
+	}
+}
+
+MpbHalSpiShftRgstrInptSrc::~MpbHalSpiShftRgstrInptSrc()
+{
+}
+
+SPI_HandleTypeDef* MpbHalSpiShftRgstrInptSrc::getSpi(){
+
+	return _hspi;
+}
+
+void MpbHalSpiShftRgstrInptSrc::_ldRgstrs(){
+	uint32_t portIdr {0};
+
+	_ldPin.portId->BSRR = ((uint32_t)_ldPin.pinNum) << 16;	//Parallel inputs latched while the shift/load input is low
+	for(uint8_t i{0}; i < _ldSttlRds; ++i)	//Back to back writes give a pulse shorter than the registers minimum load pulse width, the bus reads stretch it
+		portIdr = _ldPin.portId->IDR;
+	(void)portIdr;
+	_ldPin.portId->BSRR = _ldPin.pinNum;
+
+	return;
+}
+
+bool MpbHalSpiShftRgstrInptSrc::_rdRgstrs(uint8_t* rxBuf){
+	_ldRgstrs();
+
+	return (HAL_SPI_Receive(_hspi, rxBuf, _rgstrsCnt, _MpbShftRgstrRdTmOut) == HAL_OK);
+}
+
+bool MpbHalSpiShftRgstrInptSrc::_strtRdRgstrs(uint8_t* rxBuf){
+	_ldRgstrs();
+
+	return (HAL_SPI_Receive_DMA(_hspi, rxBuf, _rgstrsCnt) == HAL_OK);
+}
+
+void MpbHalSpiShftRgstrInptSrc::setLdSttlRds(const uint8_t &newLdSttlRds){
+	mpbCrtclSctnEnter();
+	if(_ldSttlRds != newLdSttlRds)
+		_ldSttlRds = newLdSttlRds;
+	mpbCrtclSctnExit();
+
+	return;
+}
+#endif
+
+//=========================================================================> Class methods delimiter
+
+MpbHostShftRgstrInptSrc::MpbHostShftRgstrInptSrc(const uint8_t &rgstrsCnt, const bool &actvLow)
+:MpbShftRgstrInptSrc(rgstrsCnt, actvLow)
+{
+	for(uint8_t i{0}; i < _MpbShftRgstrMaxRgstrs; ++i)
+		_simRgstrs[i] = 0xFF;
+}
+
+MpbHostShftRgstrInptSrc::~MpbHostShftRgstrInptSrc()
+{
+}
+
+bool MpbHostShftRgstrInptSrc::cmpltSimRd(){
+	bool result {false};
+
+	if(_simRxBuf != nullptr){
+		for(uint8_t i{0}; i < _rgstrsCnt; ++i)
+			_simRxBuf[i] = _simLtchd[i];
+		_simRxBuf = nullptr;
+		rxCpltIsr();
+		result = true;
+	}
+
+	return result;
+}
+
+bool MpbHostShftRgstrInptSrc::_rdRgstrs(uint8_t* rxBuf){
+	for(uint8_t i{0}; i < _rgstrsCnt; ++i)
+		rxBuf[i] = _simRgstrs[i];
+
+	return true;
+}
+
+void MpbHostShftRgstrInptSrc::setSimInpt(const uint16_t &inptIdx, const bool &newLvl){
+	if(inptIdx < _inptsCnt){
+		if(newLvl)
+			_simRgstrs[inptIdx / 8] |= (1 << (inptIdx % 8));
+		else
+			_simRgstrs[inptIdx / 8] &= ~(1 << (inptIdx % 8));
+	}
+
+	return;
+}
+
+void MpbHostShftRgstrInptSrc::setSimRgstr(const uint8_t &rgstrIdx, const uint8_t &newVal){
+	if(rgstrIdx < _rgstrsCnt)
+		_simRgstrs[rgstrIdx] = newVal;
+
+	return;
+}
+
+bool MpbHostShftRgstrInptSrc::_strtRdRgstrs(uint8_t* rxBuf){
+	for(uint8_t i{0}; i < _rgstrsCnt; ++i)	//The parallel inputs are latched when the read starts
+		_simLtchd[i] = _simRgstrs[i];
+	_simRxBuf = rxBuf;
+
+	return true;
+}
+
+//=========================================================================> Class methods delimiter
+
+MpbAdcLddrInptSrc::MpbAdcLddrInptSrc(const uint16_t* bttnsLvls, const uint8_t &bttnsCnt, const uint16_t &idleLvl, const uint16_t &tlrnc, const uint16_t &hyst)
+:MpbInptSrc(0), _hyst{hyst}, _idleLvl{idleLvl}, _tlrnc{tlrnc}
+{
+	if((bttnsLvls != nullptr) && (bttnsCnt <= _MpbAdcLddrMaxBttns)){
+		for(uint8_t i{0}; i < bttnsCnt; ++i)
+			_bttnsLvls[i] = bttnsLvls[i];
+		_inptsCnt = bttnsCnt;
+	}
+}
+
+MpbAdcLddrInptSrc::~MpbAdcLddrInptSrc()
+{
+}
+
+uint8_t MpbAdcLddrInptSrc::_clssfy(const uint16_t &val){
+	uint8_t result {0xFE};	//Not classified
+
+	if(_inRng(val, (_curCode == 0xFF)?_idleLvl:_bttnsLvls[_curCode], _tlrnc + _hyst)){	//The current code range is widened by the hysteresis
+		result = _curCode;
+	}
+	else if(_inRng(val, _idleLvl, _tlrnc)){
+		result = 0xFF;
+	}
+	else{
+		for(uint8_t i{0}; i < _inptsCnt; ++i){
+			if(_inRng(val, _bttnsLvls[i], _tlrnc)){
+				result = i;
+				break;
+			}
+		}
+	}
+
+	return result;
+}
+
+const uint8_t MpbAdcLddrInptSrc::getCnfrmScns() const{
+
+	return _cnfrmScns;
+}
+
+const uint8_t MpbAdcLddrInptSrc::getCurCode() const{
+
+	return _curCode;
+}
+
+const uint16_t MpbAdcLddrInptSrc::getFltrdVal() const{
+
+	return _fltrdVal;
+}
+
+bool MpbAdcLddrInptSrc::getInptSt(const uint16_t &inptIdx){
+
+	return (inptIdx < _inptsCnt) && (inptIdx == _curCode);
+}
+
+const uint32_t MpbAdcLddrInptSrc::getInvldSmplsCnt() const{
+
+	return _invldSmplsCnt;
+}
+
+const bool MpbAdcLddrInptSrc::getMdnFltr() const{
+
+	return _mdnFltr;
+}
+
+bool MpbAdcLddrInptSrc::_inRng(const uint16_t &val, const uint16_t &lvl, const uint16_t &rng){
+
+	return (val >= lvl)?((uint32_t)(val - lvl) <= rng):((uint32_t)(lvl - val) <= rng);
+}
+
+void MpbAdcLddrInptSrc::scan(const unsigned long int &curTm){
+	uint16_t adcVal {0};
+	uint8_t smplCode {0xFE};
+
+	(void)curTm;
+	if(_inptsCnt > 0){
+		if(_rdAdc(adcVal)){
+			_smpls[0] = _smpls[1];
+			_smpls[1] = _smpls[2];
+			_smpls[2] = adcVal;
+			if(_smplsCnt < 3)
+				++_smplsCnt;
+			if(_mdnFltr && (_smplsCnt == 3)){	//Median of three: max(min(a, b), min(max(a, b), c))
+				uint16_t mnVal {(_smpls[0] < _smpls[1])?_smpls[0]:_smpls[1]};
+				uint16_t mxVal {(_smpls[0] < _smpls[1])?_smpls[1]:_smpls[0]};
+
+				if(_smpls[2] < mxVal)
+					mxVal = _smpls[2];
+				_fltrdVal = (mnVal > mxVal)?mnVal:mxVal;
+			}
+			else{
+				_fltrdVal = adcVal;
+			}
+			smplCode = _clssfy(_fltrdVal);
+			if(smplCode == 0xFE){
+				++_invldSmplsCnt;
+				_cndtScnsCnt = 0;
+			}
+			else if(smplCode == _curCode){
+				_cndtScnsCnt = 0;
+			}
+			else{
+				if((_cndtScnsCnt > 0) && (smplCode == _cndtCode)){
+					++_cndtScnsCnt;
+				}
+				else{
+					_cndtCode = smplCode;
+					_cndtScnsCnt = 1;
+				}
+				if(_cndtScnsCnt >= _cnfrmScns){
+					mpbCrtclSctnEnter();
+					_curCode = smplCode;
+					mpbCrtclSctnExit();
+					_cndtScnsCnt = 0;
+				}
+			}
+		}
+		++_scnsCnt;
+	}
+
+	return;
+}
+
+bool MpbAdcLddrInptSrc::setCnfrmScns(const uint8_t &newCnfrmScns){
+	bool result {false};
+
+	if(newCnfrmScns > 0){
+		mpbCrtclSctnEnter();
+		if(_cnfrmScns != newCnfrmScns)
+			_cnfrmScns = newCnfrmScns;
+		mpbCrtclSctnExit();
+		result = true;
+	}
+
+	return result;
+}
+
+void MpbAdcLddrInptSrc::setMdnFltr(const bool &newMdnFltr){
+	mpbCrtclSctnEnter();
+	if(_mdnFltr != newMdnFltr)
+		_mdnFltr = newMdnFltr;
+	mpbCrtclSctnExit();
+
+	return;
+}
+
+//=========================================================================> Class methods delimiter
+
+#ifdef HAL_ADC_MODULE_ENABLED
+MpbHalAdcLddrInptSrc::MpbHalAdcLddrInptSrc(ADC_HandleTypeDef* hadc, const uint16_t* bttnsLvls, const uint8_t &bttnsCnt, const uint16_t &idleLvl, const uint16_t &tlrnc, const uint16_t &hyst)
+:MpbAdcLddrInptSrc(bttnsLvls, bttnsCnt, idleLvl, tlrnc, hyst), _hadc{hadc}
+{
+	if(_hadc == nullptr)
+		_inptsCnt = 0;
+}
+
+MpbHalAdcLddrInptSrc::~MpbHalAdcLddrInptSrc()
+{
+}
+
+ADC_HandleTypeDef* MpbHalAdcLddrInptSrc::getAdc(){
+
+	return _hadc;
+}
+
+bool MpbHalAdcLddrInptSrc::_rdAdc(uint16_t &adcVal){
+	bool result {false};
+
+	if(HAL_ADC_Start(_hadc) == HAL_OK){
+		if(HAL_ADC_PollForConversion(_hadc, _MpbAdcLddrRdTmOut) == HAL_OK){
+			adcVal = static_cast<uint16_t>(HAL_ADC_GetValue(_hadc));
+			result = true;
+		}
+		HAL_ADC_Stop(_hadc);
+	}
+
+	return result;
+}
+#endif
+
+//=========================================================================> Class methods delimiter
+
+MpbHostAdcLddrInptSrc::MpbHostAdcLddrInptSrc(const uint16_t* bttnsLvls, const uint8_t &bttnsCnt, const uint16_t &idleLvl, const uint16_t &tlrnc, const uint16_t &hyst)
+:MpbAdcLddrInptSrc(bttnsLvls, bttnsCnt, idleLvl, tlrnc, hyst), _simVal{idleLvl}
+{
+}
+
+MpbHostAdcLddrInptSrc::~MpbHostAdcLddrInptSrc()
+{
+}
+
+bool MpbHostAdcLddrInptSrc::_rdAdc(uint16_t &adcVal){
+	adcVal = _simVal;
+
+	return true;
+}
+
+void MpbHostAdcLddrInptSrc::setSimVal(const uint16_t &newSimVal){
+	if(_simVal != newSimVal)
+		_simVal = newSimVal;
+
+	return;
+}
+
+//=========================================================================> Class methods delimiter
+
+MpbDualChnlInptSrc::MpbDualChnlInptSrc(gpioPinId_t* chnlAPins, gpioPinId_t* chnlBPins, const uint8_t &pairsCnt, const bool &chnlBNC, const bool &pulledUp)
+:MpbInptSrc(0), _chnlBNC{chnlBNC}, _pulledUp{pulledUp}
+{
+	if((chnlAPins != nullptr) && (chnlBPins != nullptr) && (pairsCnt > 0) && (pairsCnt <= _MpbDualChnlMaxPairs)){
+		GPIO_InitTypeDef GPIO_InitStruct {0};
+		uint8_t portIdx {0};
+
+		/*Configure the channels pins. The distinct ports are listed, to read each port once per scan*/
+		GPIO_InitStruct.Mode = GPIO_MODE_INPUT;
+		GPIO_InitStruct.Pull = (_pulledUp)?GPIO_PULLUP:GPIO_PULLDOWN;
+		for(uint8_t i{0}; i < pairsCnt; ++i){
+			_chnlsPins[0][i] = chnlAPins[i];
+			_chnlsPins[1][i] = chnlBPins[i];
+			for(uint8_t chnl{0}; chnl < 2; ++chnl){
+				GPIO_InitStruct.Pin = _chnlsPins[chnl][i].pinNum;
+				HAL_GPIO_Init(_chnlsPins[chnl][i].portId, &GPIO_InitStruct);
+				portIdx = 0;
+				while((portIdx < _portsCnt) && (_ports[portIdx] != _chnlsPins[chnl][i].portId))
+					++portIdx;
+				if(portIdx == _portsCnt){
+					_ports[_portsCnt] = _chnlsPins[chnl][i].portId;
+					++_portsCnt;
+				}
+				_chnlsPortIdx[chnl][i] = portIdx;
+			}
+		}
+		_inptsCnt = pairsCnt;
+	}
+}
+
+MpbDualChnlInptSrc::~MpbDualChnlInptSrc()
+{
+}
+
+const uint32_t MpbDualChnlInptSrc::getDscrpncsCnt() const{
+
+	return _dscrpncsCnt;
+}
+
+const uint8_t MpbDualChnlInptSrc::getDscrpncyBtmp() const{
+
+	return _dscrpncyBtmp;
+}
+
+const unsigned long int MpbDualChnlInptSrc::getDscrpncyTm() const{
+
+	return _dscrpncyTm;
+}
+
+const bool MpbDualChnlInptSrc::getFlt(const uint8_t &pairIdx) const{
+
+	return (pairIdx < _inptsCnt) && (((_fltsBtmp >> pairIdx) & 1) != 0);
+}
+
+const bool MpbDualChnlInptSrc::getFltInptSt() const{
+
+	return _fltInptSt;
+}
+
+const uint8_t MpbDualChnlInptSrc::getFltsBtmp() const{
+
+	return _fltsBtmp;
+}
+
+const uint32_t MpbDualChnlInptSrc::getFltsCnt() const{
+
+	return _fltsCnt;
+}
+
+bool MpbDualChnlInptSrc::getInptSt(const uint16_t &inptIdx){
+	bool result {false};
+
+	if(inptIdx < _inptsCnt){
+		if(((_fltsBtmp >> inptIdx) & 1) != 0)
+			result = _fltInptSt;
+		else
+			result = ((_inptsBtmp >> inptIdx) & 1) != 0;
+	}
+
+	return result;
+}
+
+bool MpbDualChnlInptSrc::rstFlt(const uint8_t &pairIdx){
+	bool result {false};
+
+	if(pairIdx < _inptsCnt){
+		mpbCrtclSctnEnter();
+		if(((_fltsBtmp >> pairIdx) & 1) == 0){
+			result = true;
+		}
+		else if((((_actBtmp[0] | _actBtmp[1]) >> pairIdx) & 1) == 0){	//Both channels agree in the not actuated state
+			_fltsBtmp &= ~(1 << pairIdx);
+			_inptsBtmp &= ~(1 << pairIdx);
+			result = true;
+		}
+		mpbCrtclSctnExit();
+	}
+
+	return result;
+}
+
+void MpbDualChnlInptSrc::scan(const unsigned long int &curTm){
+	uint32_t portsIdr[2 * _MpbDualChnlMaxPairs]{};
+	uint8_t pairMsk {0};
+	bool actSt {false};
+
+	if(_inptsCnt > 0){
+		for(uint8_t i{0}; i < _portsCnt; ++i)	//The snapshot: each port is read once, all the channels are evaluated from the same image
+			portsIdr[i] = _ports[i]->IDR;
+		mpbCrtclSctnEnter();
+		for(uint8_t i{0}; i < _inptsCnt; ++i){
+			pairMsk = 1 << i;
+			for(uint8_t chnl{0}; chnl < 2; ++chnl){
+				actSt = ((portsIdr[_chnlsPortIdx[chnl][i]] & _chnlsPins[chnl][i].pinNum) != 0) != _pulledUp;	//The contact is closed
+				if((chnl == 1) && _chnlBNC)
+					actSt = !actSt;
+				if(actSt)
+					_actBtmp[chnl] |= pairMsk;
+				else
+					_actBtmp[chnl] &= ~pairMsk;
+			}
+			if(((_actBtmp[0] ^ _actBtmp[1]) & pairMsk) == 0){	//The channels agree
+				_dscrpncyBtmp &= ~pairMsk;
+				if(_actBtmp[0] & pairMsk)
+					_inptsBtmp |= pairMsk;
+				else
+					_inptsBtmp &= ~pairMsk;
+			}
+			else if((_dscrpncyBtmp & pairMsk) == 0){	//A new discrepancy, the last agreed state is kept
+				_dscrpncyBtmp |= pairMsk;
+				_dscrpncyStrt[i] = curTm;
+				++_dscrpncsCnt;
+			}
+			else if(((_fltsBtmp & pairMsk) == 0) && ((curTm - _dscrpncyStrt[i]) > _dscrpncyTm)){
+				_fltsBtmp |= pairMsk;
+				++_fltsCnt;
+			}
+		}
+		mpbCrtclSctnExit();
+		++_scnsCnt;
+	}
+
+	return;
+}
+
+void MpbDualChnlInptSrc::setDscrpncyTm(const unsigned long int &newVal){
+	mpbCrtclSctnEnter();
+	if(_dscrpncyTm != newVal)
+		_dscrpncyTm = newVal;
+	mpbCrtclSctnExit();
+
+	return;
+}
+
+void MpbDualChnlInptSrc::setFltInptSt(const bool &newVal){
+	mpbCrtclSctnEnter();
+	if(_fltInptSt != newVal)
+		_fltInptSt = newVal;
+	mpbCrtclSctnExit();
+
+	return;
+}
+
+//=========================================================================> Class methods delimiter
+
+/**
+ * @brief Enters a critical section for the library objects' data access.
+ *
+ * - For the FreeRTOS build the FreeRTOS taskENTER_CRITICAL() macro is used when executing in a task context, and the taskENTER_CRITICAL_FROM_ISR() macro when executing inside an ISR -as is the case of the hardware timer polling-. For the latter the interrupt mask value returned when entering the outermost critical section is saved, and a nesting level counter is kept.
+ * - For the **MPB_BARE_METAL** build the interrupts are disabled through the PRIMASK register. The PRIMASK value found when entering the outermost critical section is saved, and a nesting level counter is kept, so that nested critical sections -including those entered by code executing inside an ISR- are correctly handled.
+ *
+ * Every invocation must be paired with a mpbCrtclSctnExit() invocation.
+ */
+void mpbCrtclSctnEnter(){
+#ifndef MPB_BARE_METAL
+	if(xPortIsInsideInterrupt()){
+		UBaseType_t curIsrMsk {taskENTER_CRITICAL_FROM_ISR()};
+
+		if(mpbCrtclNstng == 0)
+			mpbCrtclSvdMsk = curIsrMsk;
+		++mpbCrtclNstng;
+	}
+	else{
+		taskENTER_CRITICAL();
+	}
+#else
+	uint32_t curPrmsk {__get_PRIMASK()};
+
+	__disable_irq();
+	if(mpbCrtclNstng == 0)
+		mpbCrtclSvdMsk = curPrmsk;
+	++mpbCrtclNstng;
+#endif
+
+	return;
+}
+
+/**
+ * @brief Exits a critical section entered by mpbCrtclSctnEnter().
+ *
+ * For the critical sections entered from an ISR and for the **MPB_BARE_METAL** build the saved interrupt mask is restored only when exiting the outermost critical section, so the interrupts are re-enabled only if they were enabled when it was entered.
+ */
+void mpbCrtclSctnExit(){
+#ifndef MPB_BARE_METAL
+	if(xPortIsInsideInterrupt()){
+		if(mpbCrtclNstng > 0){
+			--mpbCrtclNstng;
+			if(mpbCrtclNstng == 0)
+				taskEXIT_CRITICAL_FROM_ISR(mpbCrtclSvdMsk);
+		}
+	}
+	else{
+		taskEXIT_CRITICAL();
+	}
+#else
+	if(mpbCrtclNstng > 0){
+		--mpbCrtclNstng;
+		if(mpbCrtclNstng == 0)
+			__set_PRIMASK(mpbCrtclSvdMsk);
+	}
+#endif
+
+	return;
+}
+
+/**
+ * @brief Enables the clock of a GPIO port.
+ *
+ * Sets the port bit in the GPIO enabled clocks register, as done by the DbncdMPBttn constructor for it's own pin. Setting an already set bit has no effect, so the function might be invoked for ports already enabled by the application.
+ *
+ * @param gpioPort The GPIO port, ports not present in the MCU or nullptr are ignored.
+ */
+void mpbGpioClkEnbl(GPIO_TypeDef* gpioPort){
+	if(gpioPort == GPIOA){
+		__HAL_RCC_GPIOA_CLK_ENABLE();
+	}
+	else if(gpioPort == GPIOB){
+		__HAL_RCC_GPIOB_CLK_ENABLE();
+	}
+#ifdef GPIOC
+	else if(gpioPort == GPIOC){
+		__HAL_RCC_GPIOC_CLK_ENABLE();
+	}
+#endif
+#ifdef GPIOD
+	else if(gpioPort == GPIOD){
+		__HAL_RCC_GPIOD_CLK_ENABLE();
+	}
+#endif
+#ifdef GPIOE
+	else if(gpioPort == GPIOE){
+		__HAL_RCC_GPIOE_CLK_ENABLE();
+	}
+#endif
+#ifdef GPIOF
+	else if(gpioPort == GPIOF){
+		__HAL_RCC_GPIOF_CLK_ENABLE();
+	}
+#endif
+#ifdef GPIOG
+	else if(gpioPort == GPIOG){
+		__HAL_RCC_GPIOG_CLK_ENABLE();
+	}
+#endif
+#ifdef GPIOH
+	else if(gpioPort == GPIOH){
+		__HAL_RCC_GPIOH_CLK_ENABLE();
+	}
+#endif
+#ifdef GPIOI
+	else if(gpioPort == GPIOI){
+		__HAL_RCC_GPIOI_CLK_ENABLE();
+	}
+#endif
+
+	return;
+}
+
+/**
+ * @brief Returns the position of the single set bit on an unsigned 16 bits integer value.
+ *
+ * @param mask A 16 bits single bit set unsigned integer
+ * @return The position of the single bit set on the parameter value
+ * - An unsigned 8 bits integer in the range 0 ~ 15 if the parameter is a single bit set value indicating the position of that set bit.
+ * - 0xFF otherwise.
+ */
+uint8_t singleBitPosNum(uint16_t mask){
+	uint8_t result{0xFF};
+
+	if((mask > 0) && (mask & (mask - 1)) == 0){
+		result = 0;
+		mask = mask >> 1;
+		while (mask > 0){
+			mask = mask >> 1;
+			++result;
+		}
+	}
+
+	return result;
+}
+
+MpbOtpts_t otptsSttsUnpkg(uint32_t pkgOtpts){
+	MpbOtpts_t mpbCurSttsDcdd {0};
+
+	if(pkgOtpts & (((uint32_t)1) << IsOnBitPos))
+		mpbCurSttsDcdd.isOn = true;
+	else
+		mpbCurSttsDcdd.isOn = false;
+
+	if(pkgOtpts & (((uint32_t)1) << IsEnabledBitPos))
+		mpbCurSttsDcdd.isEnabled = true;
+	else
+		mpbCurSttsDcdd.isEnabled = false;
+
+	// From here on the attribute flags are not present in every subclass!!
+	if(pkgOtpts & (((uint32_t)1) << PilotOnBitPos))
+		mpbCurSttsDcdd.pilotOn = true;
+	else
+		mpbCurSttsDcdd.pilotOn = false;
+
+	if(pkgOtpts & (((uint32_t)1) << WrnngOnBitPos))
+		mpbCurSttsDcdd.wrnngOn = true;
+	else
+		mpbCurSttsDcdd.wrnngOn = false;
+
+	if(pkgOtpts & (((uint32_t)1) << IsVoidedBitPos))
+		mpbCurSttsDcdd.isVoided = true;
+	else
+		mpbCurSttsDcdd.isVoided = false;
+
+	if(pkgOtpts & (((uint32_t)1) << IsOnScndryBitPos))
+		mpbCurSttsDcdd.isOnScndry = true;
+	else
+		mpbCurSttsDcdd.isOnScndry = false;
+
+	if(pkgOtpts & (((uint32_t)1) << EvntPendBitPos))
+		mpbCurSttsDcdd.evntPend = true;
+	else
+		mpbCurSttsDcdd.evntPend = false;
 
+	mpbCurSttsDcdd.actvChnl = (pkgOtpts >> ActvChnlBitPos) & 0x03;
 	mpbCurSttsDcdd.otptCurVal = (pkgOtpts & 0xffff0000) >> OtptCurValBitPos;
 
 	return mpbCurSttsDcdd;
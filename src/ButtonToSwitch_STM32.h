@@ -52,17 +52,48 @@
 #endif
 //===========================>> Previous lines included for developing purposes, corresponding headers must be provided for the production platform/s
 
+/*===========================>> Bare-metal build option
+ * Defining MPB_BARE_METAL (i.e. adding -DMPB_BARE_METAL to the compiler flags) builds the library without any FreeRTOS dependency:
+ * - Critical sections are implemented by masking interrupts through the PRIMASK register.
+ * - The begin(), pause(), resume() and end() timer related methods, and the tasks related methods and attributes are not included.
+ * - The objects must be updated by the DbncdMPBttn::update(const unsigned long int &) or MpbGrp::updateAll(const unsigned long int &) methods, invoked from a periodic source -SysTick or a hardware timer interrupt, or the main loop-, using HAL_GetTick() or any other milliseconds counter as time reference.
+ * - The outputs change notification is provided by the outputsChange flag and the function set by DbncdMPBttn::setFnWhnOtptsChngPtr(void (*)(uint32_t)).
+ */
+#ifndef MPB_BARE_METAL
 //===========================>> BEGIN libraries used to avoid CMSIS wrappers
 #include "FreeRTOS.h"
 #include "task.h"
 #include "timers.h"
 #include "semphr.h"
 //===========================>> END libraries used to avoid CMSIS wrappers
+#endif
 
 #define _HwMinDbncTime 20  // Documented minimum wait time for a MPB signal to stabilize to consider it pressed or released (in milliseconds)
 #define _StdPollDelay 10	// Reasonable time between polls for MPBs switches (in milliseconds)
 #define _MinSrvcTime 100	// Minimum valid time value for service/active time for Time Latched MPBs to avoid stability issues relating to debouncing, releasing and other timed events
 #define _InvalidPinNum 0xFFFF	// Value to give as "yet to be defined", the "Valid pin number" range and characteristics are development platform and environment dependable
+#define _MpbGrpMaxSize 64	// Maximum number of MPB objects that might be registered in a single MpbGrp object
+#define _MpbGrpMaxOtptBndngs 16	// Maximum number of output bindings that might be set in a single MpbGrp object
+#define _MpbSchdlrMaxClss 4	// Maximum number of polling rate classes managed by a MpbSchdlr object
+#define _MpbSbscrbrsMaxQty 4	// Maximum number of subscribers each object might notify of it's isOn attribute flag changes
+#define _MltChnlSldrMaxChnls 4	// Maximum number of channels of a MltChnlSldrDALtchMPBttn object, limited by the 64 bits channels values package
+#define _MpbGrpMaxInptSrcs 4	// Maximum number of input sources that might be registered in a single MpbGrp object
+#define _MpbRdGrpMaxSize 16	// Maximum number of mutually exclusive latching objects in a single MpbRdGrp radio group
+#define _MpbMtrxMaxLines 16	// Maximum number of rows and of columns of a MpbMtrxInptSrc key matrix
+#define _MpbMtrxMaxKeys 128	// Maximum number of keys (rows x columns) of a MpbMtrxInptSrc key matrix
+#define _MpbMtrxStdSttlRds 4	// Default number of dummy column port reads executed after driving a key matrix row, to let the column lines settle
+#define _MpbShftRgstrMaxRgstrs 8	// Maximum number of chained 8 bits shift registers read by a MpbShftRgstrInptSrc object
+#define _MpbShftRgstrRdTmOut 2	// Time out for the blocking shift registers chain read (in milliseconds)
+#define _MpbShftRgstrStdLdSttlRds 4	// Default number of dummy load pin port reads executed while the shift registers load input is held low, to stretch the load pulse
+#define _RtryEncdrVlctyTmOut 500	// Time without detents after which a RtryEncdrMPBttn object velocity is considered 0 (in milliseconds)
+#define _SlctrSwtchMaxPstns 16	// Maximum number of positions of a SlctrSwtchMPBttn selector switch
+#define _SlctrSwtchStdBrkTmOut 200	// Default time a selector switch might show no position active before being considered faulty (in milliseconds)
+#define _TwoHndStdSmltntyWndw 500	// Default maximum time between the presses of the two buttons of a TwoHndMPBttn two-hand control (in milliseconds)
+#define _MpbSwInptsMaxQty 32	// Maximum number of inputs of a MpbSwInptSrc software input source
+#define _MpbAdcLddrMaxBttns 8	// Maximum number of buttons of a MpbAdcLddrInptSrc resistor ladder
+#define _MpbAdcLddrRdTmOut 2	// Time out for the ADC conversion of a MpbHalAdcLddrInptSrc object (in milliseconds)
+#define _MpbDualChnlMaxPairs 8	// Maximum number of dual channel inputs of a MpbDualChnlInptSrc object
+#define _MpbDualChnlStdDscrpncyTm 100	// Default maximum time the two channels of a dual channel input might disagree before a fault is latched (in milliseconds)
 
 /*---------------- xTaskNotify() mechanism related constants, argument structs, information packing and unpacking BEGIN -------*/
 const uint8_t IsOnBitPos {0};
@@ -71,6 +102,8 @@ const uint8_t PilotOnBitPos{2};
 const uint8_t WrnngOnBitPos{3};
 const uint8_t IsVoidedBitPos{4};
 const uint8_t IsOnScndryBitPos{5};
+const uint8_t EvntPendBitPos{6};
+const uint8_t ActvChnlBitPos{8};	// 2 bits field
 const uint8_t OtptCurValBitPos{16};
 
 #ifndef MPBOTPTS_T
@@ -88,11 +121,76 @@ const uint8_t OtptCurValBitPos{16};
 		bool wrnngOn;
 		bool isVoided;
 		bool isOnScndry;
+		bool evntPend;
+		uint8_t actvChnl;
 		uint16_t otptCurVal;
 	};
 #endif
 /*---------------- xTaskNotify() mechanism related constants, argument structs, information packing and unpacking END -------*/
 
+/*---------------- Edge events mechanism related constants, types and structs BEGIN -------*/
+#define _MpbEvntsQSize 8	// Number of edge events each object keeps queued until they are read by the consumer
+
+#ifndef MPBEVNT_T
+	#define MPBEVNT_T
+	/**
+	 * @brief Type of the edge events generated by the DbncdMPBttn class and subclasses objects.
+	 *
+	 * Each value identifies a transition of the object's state, the events that are relevant for each class depend on the attribute flags implemented by that class. The value of each event type is also the position of the bit that enables it's generation in the events mask (see DbncdMPBttn::setEvntsMask(const uint32_t)).
+	 */
+	enum MpbEvntType_t: uint8_t{
+		evntNone,	/**< No event, returned when the events queue is empty*/
+		evntVldPrss,	/**< Valid press detected (debounce & delay completed)*/
+		evntVldRls,	/**< Valid release detected*/
+		evntOn,	/**< isOn attribute flag set*/
+		evntOff,	/**< isOn attribute flag reset*/
+		evntLtchd,	/**< isLatched attribute flag set*/
+		evntUnltchd,	/**< isLatched attribute flag reset*/
+		evntVdd,	/**< isVoided attribute flag set*/
+		evntUnvdd,	/**< isVoided attribute flag reset*/
+		evntScndryOn,	/**< isOnScndry attribute flag set*/
+		evntScndryOff,	/**< isOnScndry attribute flag reset*/
+		evntWrnngOn,	/**< wrnngOn attribute flag set*/
+		evntWrnngOff,	/**< wrnngOn attribute flag reset*/
+		evntPilotOn,	/**< pilotOn attribute flag set*/
+		evntPilotOff,	/**< pilotOn attribute flag reset*/
+		evntSnglClck,	/**< Single click sequence completed, see DbncdMPBttn::setClckWndw(const unsigned long int &)*/
+		evntDblClck,	/**< Double click sequence completed*/
+		evntTrplClck,	/**< Triple click sequence completed*/
+		evntMltClck,	/**< Sequence of four or more clicks completed, the clicks count is available through DbncdMPBttn::getLstClckCnt()*/
+		evntRpt	/**< Auto-repeat event generated while the MPB is kept pressed, see DbncdDlydMPBttn::setRpt()*/
+	};
+	/**
+	 * @brief Type to hold a single edge event generated by a DbncdMPBttn class and subclasses object.
+	 *
+	 * The event includes the type of transition and the time -in milliseconds, same time base used for all the time related attributes of the classes- at which the transition took place.
+	 * - For the **evntVldPrss** and **evntVldRls** events the time is the moment the input signal started to be stable in the new level, i.e. the start of the debounce period that ended validating it.
+	 * - For the click sequence events the time is the moment the last click of the sequence was validated as released.
+	 * - For the auto-repeat events the time is the moment the repeat was scheduled for, calculated from the press start time.
+	 * - For the rest of the events the time is the moment the object's state machine produced the attribute flag change.
+	 */
+	struct MpbEvnt_t{
+		MpbEvntType_t evntType;
+		unsigned long int evntTm;
+	};
+#endif
+/*---------------- Edge events mechanism related constants, types and structs END -------*/
+
+/*---------------- Slider ramp profiles related types BEGIN -------*/
+#ifndef SLDRRMPPRFL_T
+	#define SLDRRMPPRFL_T
+	/**
+	 * @brief Type of the ramp profiles available for the SldrDALtchMPBttn class objects otptCurVal changes.
+	 */
+	enum SldrRmpPrfl_t: uint8_t{
+		rmpLnr,	/**< Linear ramp, every step changes the value by otptSldrStpSize*/
+		rmpAccl,	/**< Accelerating ramp, the step size is multiplied by a factor that increments with the hold time*/
+		rmpExp,	/**< Exponential ramp, the step size is proportional to the distance from otptValMin, fine at the low end of the range and coarse at the high end*/
+		rmpLut	/**< Lookup table ramp, the step size is taken from a table indexed by the position of the value in the range*/
+	};
+#endif
+/*---------------- Slider ramp profiles related types END -------*/
+
 #ifndef GPIOPINID_T
 	#define GPIOPINID_T
 	/**
@@ -111,8 +209,13 @@ const uint8_t OtptCurValBitPos{16};
 // Definition workaround to let a function/method return value to be a function pointer
 typedef void (*fncPtrType)();
 typedef  fncPtrType (*ptrToTrnFnc)();
+typedef void (*fncOtptsChngPtrType)(uint32_t);
+typedef void (*fncChnlsChngPtrType)(uint64_t);
 
 //===========================>> BEGIN General use function prototypes
+void mpbCrtclSctnEnter();
+void mpbCrtclSctnExit();
+void mpbGpioClkEnbl(GPIO_TypeDef* gpioPort);
 uint8_t singleBitPosNum(uint16_t mask);
 MpbOtpts_t otptsSttsUnpkg(uint32_t pkgOtpts);
 //===========================>> END General use function prototypes
@@ -121,6 +224,8 @@ MpbOtpts_t otptsSttsUnpkg(uint32_t pkgOtpts);
 //===========================>> END General use Global variables
 
 //==========================================================>> Classes declarations BEGIN
+class MpbInptSrc;
+
 /**
  * @brief Base class, models a Debounced Momentary Push Button (**D-MPB**).
  *
@@ -147,40 +252,80 @@ protected:
 	bool _typeNO{};
 	unsigned long int _dbncTimeOrigSett{};
 
+	uint8_t _clckCnt{0};
+	bool _clckHld{false};
+	bool _clckPrssd{false};
+	unsigned long int _clckWndw{0};
+	unsigned long int _clckWndwStrt{0};
+	unsigned long int _curPollTm{0};
 	unsigned long int _dbncRlsTimerStrt{0};
 	unsigned long int _dbncRlsTimeTempSett{0};
 	unsigned long int _dbncTimerStrt{0};
 	unsigned long int _dbncTimeTempSett{0};
+	void (*_fnWhnOtptsChng)(uint32_t) {nullptr};
 	void (*_fnWhnTrnOff)() {nullptr};
 	void (*_fnWhnTrnOn)() {nullptr};
+	uint16_t _inptIdx{0};
+	MpbInptSrc* _inptSrc{nullptr};
    bool _isEnabled{true};
 	volatile bool _isOn{false};
    bool _isOnDisabled{false};
 	volatile bool _isPressed{false};
 	fdaDmpbStts _mpbFdaState {stOffNotVPP};
+#ifndef MPB_BARE_METAL
 	TimerHandle_t _mpbPollTmrHndl {NULL};
 	std::string _mpbPollTmrName {""};
+#endif
 	volatile bool _outputsChange {false};
 	bool _prssRlsCcl{false};
+	unsigned long int _rptAcclStp{0};
+	uint16_t _rptCnt{0};
+	unsigned long int _rptCurPrd{0};
+	unsigned long int _rptDly{0};
+	unsigned long int _rptNxtTm{0};
+	unsigned long int _rptPrdMin{0};
+	unsigned long int _rptPrdStrt{0};
+	bool _rptPrssd{false};
    unsigned long int _strtDelay {0};
 	bool _sttChng {true};
+#ifndef MPB_BARE_METAL
 	TaskHandle_t _taskToNotifyHndl {NULL};
 	TaskHandle_t _taskWhileOnHndl{NULL};
+#endif
 	volatile bool _validDisablePend{false};
 	volatile bool _validEnablePend{false};
 	volatile bool _validPressPend{false};
 	volatile bool _validReleasePend{false};
+	MpbEvnt_t _evntsQ[_MpbEvntsQSize]{};
+	uint8_t _evntsQCnt{0};
+	uint8_t _evntsQHead{0};
+	uint32_t _evntsMask{0};
+	bool _evntsOvrflw{false};
+	uint8_t _lstClckCnt{0};
+	DbncdMPBttn* _sbscrbrsArr[_MpbSbscrbrsMaxQty]{};
+	uint8_t _sbscrbrsCnt{0};
+	static uint32_t _sbscrptnsVer;
 
 	void clrSttChng();
 	const bool getIsPressed() const;
+#ifndef MPB_BARE_METAL
 	static void mpbPollCallback(TimerHandle_t mpbTmrCb);
+#endif
+	virtual void _notifyOtptsChng();
 	virtual uint32_t _otptsSttsPkg(uint32_t prevVal = 0);
+	void _pblshIsOn();
+	void _pushEvnt(const MpbEvntType_t &evntType, const unsigned long int &evntTm);
+	virtual void _rcvPblshrChng(DbncdMPBttn* pblshr, const bool &pblshrIsOn);
+	bool _rdPrssSt();
    void _setIsEnabled(const bool &newEnabledValue);
    void setSttChng();
 	void _turnOff();
 	void _turnOn();
+	void _updClcks();
+	void _updRpt();
 	virtual void updFdaState();
-	bool updIsPressed();
+	virtual bool updIsPressed();
+	virtual void updPollFlags();
 	virtual bool updValidPressesStatus();
 public:
 	/**
@@ -213,6 +358,20 @@ public:
 	 *
 	 */
 	virtual ~DbncdMPBttn();
+	/**
+	 * @brief Subscribes an object to be notified of this object's **isOn** attribute flag changes.
+	 *
+	 * The subscription mechanism replaces the polling of one object's state by another, as used by objects depending on other objects' state (i.e. a XtrnUnltchMPBttn object depending on it's unlatching object). Every time the **isOn** flag of this object -the publisher- changes, each subscriber is notified in the same update cycle, so that the subscriber will have the information available at it's next update. When the publisher and the subscribers are updated as part of the same MpbGrp group, the group updates the publishers before their subscribers (see MpbGrp::updateAll(const unsigned long int &)), so that chained objects react in the same update cycle.
+	 *
+	 * @note When the objects are polled by a MpbSchdlr scheduler, the publishers and their subscribers registered in the same rate class are polled in the same slot, publishers first. Objects registered in different rate classes are not ordered, the subscriber reacting at it's first poll after the publisher's change.
+	 *
+	 * @param newSbscrbr Pointer to the object to subscribe.
+	 *
+	 * @retval true: The object was subscribed.
+	 * @retval false: The object was not subscribed, the pointer was nullptr or this same object, the object was already subscribed or the maximum number of subscribers (_MpbSbscrbrsMaxQty) was reached.
+	 */
+	bool addSbscrbr(DbncdMPBttn* newSbscrbr);
+#ifndef MPB_BARE_METAL
 	/**
 	 * @brief Attaches the instantiated object to a timer that monitors the input pins and updates the object status.
 	 *
@@ -225,6 +384,7 @@ public:
 	 * @retval false: the object could not create the needed timer, or the object could not be attached to it.
 	 */
 	virtual bool begin(const unsigned long int &pollDelayMs = _StdPollDelay);
+#endif
 	/**
 	 * @brief Clears and resets flags, timers and counters modified through the object's signals processing.
 	 *
@@ -236,6 +396,10 @@ public:
 	 * - false excludes the isOn flag.
 	 */
 	void clrStatus(bool clrIsOn = true);
+	/**
+	 * @brief Discards all the edge events queued and not yet read, and clears the events queue overflow flag.
+	 */
+	void clrEvnts();
    /**
 	 * @brief Disables the input signal processing, ignoring the changes of its values.
 	 *
@@ -256,6 +420,7 @@ public:
 	 * - Due to strict security enforcement the object will not be allowed to enter the **Enabled state** if the MPB was pressed when the enable message was received and until a MPB release is efectively detected.
     */
    void enable();
+#ifndef MPB_BARE_METAL
 	/**
 	 * @brief Detaches the object from the timer that monitors the input pins, compute and updates the object's status. The timer daemon entry is deleted for the object.
 	 *
@@ -266,6 +431,19 @@ public:
 	 * @retval false: the object detachment and/or entry removal was rejected by the O.S..
 	 */
 	bool end();
+#endif
+	/**
+	 * @brief Delivers the pending outputs change notification, if any.
+	 *
+	 * Executes the outputs change notification mechanisms -the outputs change function and the task to notify- as done at the end of each update cycle. Intended for the objects updated with the notification deferred (see update(const unsigned long int &, const bool &)), so that a group might deliver all it's objects notifications once all of them reached a coherent state.
+	 */
+	void flshOtptsChng();
+	/**
+	 * @brief Returns the click sequences window time set for the object.
+	 *
+	 * @return The click window time in milliseconds, 0 if the click sequences detection is disabled. See setClckWndw(const unsigned long int &).
+	 */
+	const unsigned long int getClckWndw() const;
 	/**
 	 * @brief Returns the current debounce period time set for the object.
 	 *
@@ -274,6 +452,45 @@ public:
 	 * @return The current debounce time in milliseconds
 	 */
    const unsigned long int getCurDbncTime() const;
+	/**
+	 * @brief Gets the oldest edge event queued by the object, removing it from the events queue.
+	 *
+	 * Every time the object's state changes, and the corresponding event type is enabled in the events mask (see setEvntsMask(const uint32_t)), an event is queued including the type of the transition and the time it took place. The queue holds up to _MpbEvntsQSize events, if the events are not read and the queue gets full, the newer events are discarded and the events queue overflow flag is set (see getEvntsOvrflw()).
+	 *
+	 * @param evnt Reference to a MpbEvnt_t variable to receive the event read. If the queue was empty the evntType member is set to **evntNone**.
+	 *
+	 * @retval true: An event was read from the queue.
+	 * @retval false: The events queue was empty.
+	 */
+	bool getEvnt(MpbEvnt_t &evnt);
+	/**
+	 * @brief Returns the number of edge events queued and not yet read.
+	 *
+	 * @return The number of events in the events queue.
+	 */
+	const uint8_t getEvntsCnt() const;
+	/**
+	 * @brief Returns the current setting of the events mask.
+	 *
+	 * @return The events mask, each set bit enables the generation of the event type whose value is the bit position.
+	 */
+	const uint32_t getEvntsMask() const;
+	/**
+	 * @brief Returns the value of the events queue overflow flag.
+	 *
+	 * @retval true: At least one event was discarded due to the events queue being full since the last clrEvnts() invocation.
+	 * @retval false: No events were discarded.
+	 */
+	const bool getEvntsOvrflw() const;
+	/**
+	 * @brief Returns the function that is set to execute every time the object's outputs change.
+	 *
+	 * The function to be executed is an attribute that might be modified by the **setFnWhnOtptsChngPtr()** method.
+	 *
+	 * @return A function pointer to the function set to execute every time the object's outputs change.
+	 * @retval nullptr if there is no function set to execute when the object's outputs change.
+	 */
+	fncOtptsChngPtrType getFnWhnOtptsChng();
 	/**
 	 * @brief Returns the function that is set to execute every time the object **enters** the **Off State**.
 	 *
@@ -296,6 +513,19 @@ public:
 	 * 	 * @warning The function code execution will become part of the list of procedures the object executes when it entering the **On State**, including the modification of affected attribute flags, suspending the execution of the task running while in **On State** and others. Making the function code too time demanding must be handled with care, using alternative execution schemes, for example the function might resume a independent task that suspends itself at the end of its code, to let a new function calling event resume it once again.
 	 */
    fncPtrType getFnWhnTrnOn();
+	/**
+	 * @brief Returns the index of the input of the input source the object is bound to.
+	 *
+	 * @return The input index, meaningful only if an input source is set, see setInptSrc(MpbInptSrc*, const uint16_t &).
+	 */
+	const uint16_t getInptIdx() const;
+	/**
+	 * @brief Returns the input source the object is bound to.
+	 *
+	 * @return A pointer to the input source.
+	 * @retval nullptr: No input source is set, the object reads it's own GPIO input pin.
+	 */
+	MpbInptSrc* getInptSrc();
    /**
 	 * @brief Returns the value of the isEnabled attribute flag, indicating the **Enabled** or **Disabled** status of the object.
 	 *
@@ -326,6 +556,12 @@ public:
     * @retval false: the object is configured to be set to the **Off state** while it is in **Disabled state**.
     */
    const bool getIsOnDisabled() const;
+	/**
+	 * @brief Returns the number of clicks of the last completed click sequence.
+	 *
+	 * @return The clicks count of the last sequence, 0 if no sequence was completed yet.
+	 */
+	const uint8_t getLstClckCnt() const;
    /**
 	 * @brief Returns the relevant attribute flags values for the object state encoded as a 32 bits value, required to pass current state of the object to another thread/task managing the outputs
     *
@@ -345,6 +581,20 @@ public:
     * @retval false: no object's behavior flags have changed value since last time **outputsChange** flag was reseted.
 	 */
    const bool getOutputsChange() const;
+	/**
+	 * @brief Returns the number of auto-repeat events generated since the MPB was last pressed.
+	 *
+	 * @return The repeats count, kept after the release until the next valid press.
+	 */
+	const uint16_t getRptCnt() const;
+	/**
+	 * @brief Returns the auto-repeat start delay set for the object.
+	 *
+	 * @return The auto-repeat start delay in milliseconds, 0 if the auto-repeat is disabled. See DbncdDlydMPBttn::setRpt().
+	 *
+	 * @attention The auto-repeat is disabled at instantiation, and no setter mechanism is provided in this class. The inherited DbncdDlydMPBttn class objects (and all it's subclasses) include a method to configure it.
+	 */
+	const unsigned long int getRptDly() const;
    /**
     * @brief Returns the current value of strtDelay attribute.
     *
@@ -355,6 +605,30 @@ public:
     * @attention The strtDelay attribute is forced to a 0 ms value at instantiation of DbncdMPBttn class objects, and no setter mechanism is provided in this class. The inherited DbncdDlydMPBttn class objects (and all it's subclasses) constructor includes a parameter to initialize the strtDelay value, and a method to set that attribute to a new value.
     */
    unsigned long int getStrtDelay();
+	/**
+	 * @brief Returns a pointer to one of the objects subscribed to this object's **isOn** attribute flag changes.
+	 *
+	 * @param sbscrbrIdx Index of the subscriber, in the subscription order.
+	 *
+	 * @return The pointer to the subscriber.
+	 * @retval nullptr: There's no subscriber with that index.
+	 */
+	DbncdMPBttn* getSbscrbr(const uint8_t &sbscrbrIdx);
+	/**
+	 * @brief Returns the number of objects subscribed to this object's **isOn** attribute flag changes.
+	 *
+	 * @return The number of subscribers.
+	 */
+	const uint8_t getSbscrbrsCnt() const;
+	/**
+	 * @brief Returns the subscriptions version number.
+	 *
+	 * The version number is a counter shared by all the objects, incremented every time any subscription is added or removed, so that the dependency related ordering mechanisms are able to detect the need to recalculate the dependencies.
+	 *
+	 * @return The subscriptions version number.
+	 */
+	static uint32_t getSbscrptnsVer();
+#ifndef MPB_BARE_METAL
    /**
 	 * @brief Returns the task to be notified by the object when its output flags changes.
 	 *
@@ -377,6 +651,7 @@ public:
     * @warning Free-RTOS has no mechanism implemented to notify a task that it is about to be set in **paused** state, so there is no way to that task to ensure it will be set to pause in an orderly fashion. The task to be designated to be used by this mechanism has to be task that can withstand being interrupted at any point of it's execution, and be restarted from that same point next time the **isOn** flag is set. For tasks that might need attaching resources or other issues every time it is resumed and releasing resources of any kind before being **paused**, using the function attached by using **setFnWhnTrnOnPtr()** to gain control of the resources before resuming a task, and the function attached by using **setFnWhnTrnOffPtr()** to release the resources and pause the task in an orderly fashion, or use those functions to manage a binary semaphore for managing the execution of a task.
 	 */
 	const TaskHandle_t getTaskWhileOn();
+#endif
 	/**
 	 * @brief Initializes an object instantiated by the default constructor
 	 *
@@ -389,6 +664,7 @@ public:
 	 * All the parameters correspond to the non-default constructor of the class, DbncdMPBttn(gpioPinId_t, const bool, const bool, const unsigned long int)
 	 */
 	bool init(gpioPinId_t mpbttnPinStrct, const bool &pulledUp = true, const bool &typeNO = true, const unsigned long int &dbncTimeOrigSett = 0);
+#ifndef MPB_BARE_METAL
 	/**
 	 * @brief Pauses the software timer updating the computation of the object's internal flags value.
 	 *
@@ -398,6 +674,7 @@ public:
 	 * @retval false: the object's timer couldn't be stopped by the O.S..
 	 */
 	bool pause();
+#endif
 	/**
 	 * @brief Resets the debounce process time of the object to the value used at instantiation.
 	 *
@@ -409,7 +686,8 @@ public:
 	 *
 	 * This method is provided for security and for error handling purposes, so that in case of unexpected situations detected, the driving **Deterministic Finite Automaton** used to compute the MPB objects states might be reset to it's initial state to safely restart it, usually as part of an **Error Handling** procedure.
 	 */
-	void resetFda();
+	virtual void resetFda();
+#ifndef MPB_BARE_METAL
 	/**
 	 * @brief Restarts the software timer updating the calculation of the object internal flags.
 	 *
@@ -421,6 +699,28 @@ public:
 	 * @warning This method will restart the inactive timer after a **pause()** method. If the object's timer was modified by an **end()* method then a **begin()** method will be needed to restart it's timer.
 	 */
 	bool resume();
+#endif
+	/**
+	 * @brief Unsubscribes an object from this object's **isOn** attribute flag changes notifications.
+	 *
+	 * @param sbscrbr Pointer to the object to unsubscribe.
+	 *
+	 * @retval true: The object was unsubscribed.
+	 * @retval false: The object was not subscribed.
+	 */
+	bool rmvSbscrbr(DbncdMPBttn* sbscrbr);
+	/**
+	 * @brief Sets the click sequences window time, enabling the multi-click detection.
+	 *
+	 * A **click** is a valid press followed by a valid release, with the MPB kept pressed less than the click window time. A **click sequence** is a succession of clicks, each one starting -being validated as pressed- within the click window time from the release of the previous one. The sequence is completed when the click window time elapses with no new press after the last release, and an event identifying the clicks count is queued: **evntSnglClck**, **evntDblClck**, **evntTrplClck** or **evntMltClck**, provided it's enabled in the events mask (see setEvntsMask(const uint32_t &)).
+	 * If the MPB is kept pressed for the click window time or longer the press is considered a **hold**: the sequence in progress is discarded, and no clicks are counted until the next release.
+	 * The detection is built on the valid presses and releases already produced by the debouncing process, using a single time stamp per object, and adds no timers.
+	 *
+	 * @param newVal The click window time in milliseconds. The value 0 -the instantiation default- disables the detection.
+	 *
+	 * @note The detection doesn't modify the object's state machine: i.e. for a toggle switch every click of a double click still toggles the isOn state. Selecting the object class according to the expected usage is the developer's responsibility.
+	 */
+	void setClckWndw(const unsigned long int &newVal);
 	/**
 	 * @brief Sets the debounce process time.
 	 *
@@ -433,6 +733,26 @@ public:
 	 * @retval false: the value was out of the accepted range, no change was made.
 	 */
 	bool setDbncTime(const unsigned long int &newDbncTime);
+	/**
+	 * @brief Sets the events mask, selecting which edge events the object will queue.
+	 *
+	 * Each bit of the mask enables the generation of the event type whose MpbEvntType_t value is the bit position, i.e. (1UL << evntVldPrss) enables the valid press events. When instantiated the mask is set to 0, no events are generated and the mechanism adds no processing to the object's updates.
+	 *
+	 * @param newEvntsMask The new value for the events mask.
+	 *
+	 * @note Every time an enabled event is queued the **outputsChange** attribute flag is set, so that a task set to be notified (see setTaskToNotify(const TaskHandle_t)) is unblocked to read the events queue. The notification value includes the **evntPend** flag to indicate there are events to be read.
+	 */
+	void setEvntsMask(const uint32_t &newEvntsMask);
+	/**
+	 * @brief Sets the function that will be called to execute every time the object's outputs change.
+	 *
+	 * This is the notification mechanism alternative to the task notification (see setTaskToNotify(const TaskHandle_t)), and the only one provided when the library is built with the **MPB_BARE_METAL** option. The function to be executed must be of the form **void (*newFnWhnOtptsChng)(uint32_t)**, it will be called at the end of each update cycle in which the **outputsChange** attribute flag was set, receiving the packed output words (see getOtptsSttsPkgd()) as argument, after which the **outputsChange** flag is reset. When instantiated the attribute value is set to **nullptr**.
+	 *
+	 * @param newFnWhnOtptsChng Function pointer to the function intended to be called when the object's outputs change. Passing **nullptr** as parameter deactivates the function execution mechanism.
+	 *
+	 * @warning The function is executed in the context of the update cycle invocation, when polling from an interrupt service routine (bare-metal SysTick or hardware timer polling) the function will be executed inside the ISR, so it must be kept short and ISR safe.
+	 */
+	void setFnWhnOtptsChngPtr(void (*newFnWhnOtptsChng)(uint32_t));
 	/**
 	 * @brief Sets the function that will be called to execute every time the object **enters** the **Off State**.
 	 *
@@ -449,6 +769,22 @@ public:
 	 * @param newFnWhnTrnOn: function pointer to the function intended to be called when the object **enters** the **On State**. Passing **nullptr** as parameter deactivates the function execution mechanism.
 	 */
 	void setFnWhnTrnOnPtr(void (*newFnWhnTrnOn)());
+	/**
+	 * @brief Binds the object to an input of an input source, replacing the GPIO input pin as the MPB signal source.
+	 *
+	 * Input sources (see MpbInptSrc) provide the raw state of many inputs read in a single operation -a key matrix scan, an expander burst read-, each object being bound to one of those inputs. The input state is processed by the object's state machine -debouncing, delays and the rest of the class behavior- exactly as the GPIO pin level would be. The input state provided by the source is the **active** state of the contact, so the **typeNO** attribute keeps it's meaning (a Normally Closed contact is pressed when it's input is inactive), while the **pulledUp** attribute is ignored.
+	 *
+	 * Objects to be bound to an input source might be instantiated with **_InvalidPinNum** as pin number, so that no GPIO pin is configured for them.
+	 *
+	 * @param newInptSrc Pointer to the input source. Passing **nullptr** unbinds the object, that returns to read it's GPIO input pin -if a valid one was set-.
+	 * @param newInptIdx Index of the input in the source.
+	 *
+	 * @retval true: The object was bound to the input, or unbound.
+	 * @retval false: The index is not a valid input index for the source, the binding was not changed.
+	 *
+	 * @note The input source image must be refreshed before the object is updated, see MpbGrp::addInptSrc(MpbInptSrc*).
+	 */
+	bool setInptSrc(MpbInptSrc* newInptSrc, const uint16_t &newInptIdx = 0);
    /**
 	 * @brief Sets the value of the **isOnDisabled** attribute.
 	 *
@@ -468,6 +804,7 @@ public:
     * @param newOutputChange The new value to set the **outputsChange** flag to.
     */
    void setOutputsChange(bool newOutputChange);
+#ifndef MPB_BARE_METAL
    /**
 	 * @brief Sets the pointer to the task to be notified by the object when its output attribute flags changes.
 	 *
@@ -492,8 +829,27 @@ public:
     * @note Consider the implications of the task that's going to get suspended every time the MPB goes to the **Off state**, so that the the task to be run might be interrupted at any point of its execution. This implies that the task must be designed with that consideration in mind to avoid dangerous situations generated by a task not completely done when suspended.
     *
     * @warning Take special consideration about the implications of the execution **priority** of the task to be executed while the MPB is in **On state** and its relation to the priority of the calling task, as it might affect the normal execution of the application.
+    *
+    * @warning The mechanism is not available when the object is updated from an ISR -as when polled by a MpbPollSrc hardware timer source- as FreeRTOS provides no ISR safe version of the task suspending service.
 	 */
 	virtual void setTaskWhileOn(const TaskHandle_t &newTaskHandle);
+#endif
+	/**
+	 * @brief Executes a complete update cycle of the object, as a synchronous alternative to the timer polling.
+	 *
+	 * The method executes the same sequence the timer callback set by begin() executes in each poll: input signal update, flags and triggers calculation and state machine update, as a single critical section, followed by the task notification if a task to notify is set and the outputs changed. This provides a **synchronous scan-cycle mode** where no begin() timer is needed, and the input sampling, logic and outputs update are executed in the moment the application decides, aligned with its own cyclic executive or main loop.
+	 *
+	 * The time value passed as parameter is the only time reference used by the object in the cycle, for debouncing, delays, timers and events time stamps. It is expected to be a monotonically increasing milliseconds counter, with the usual unsigned overflow wrap-around.
+	 *
+	 * @param curTm Current time in milliseconds, as kept by the application.
+	 *
+	 * @warning The timer polling mechanism and this method must not be used simultaneously for the same object, as each would be working with its own time base, and the poll rate would be altered.
+	 *
+	 * @param dfrNtf (Optional) If true the outputs change notification is not delivered by the cycle, but kept pending to be delivered by flshOtptsChng(). The default value is false.
+	 *
+	 * @note To update a set of objects in a deterministic order using a single call, see MpbGrp::updateAll(const unsigned long int &)
+	 */
+	void update(const unsigned long int &curTm, const bool &dfrNtf = false);
 };
 
 //==========================================================>>
@@ -553,6 +909,24 @@ public:
      * @warning: Using very high **delay** values is valid but might make the system seem less responsive, be aware of how it will affect the user experience.
      */
     void setStrtDelay(const unsigned long int &newStrtDelay);
+    /**
+     * @brief Configures the auto-repeat (typematic) mechanism.
+     *
+     * While the MPB is kept pressed, auto-repeat events (**evntRpt**) are queued -if enabled in the events mask, see setEvntsMask(const uint32_t &)-: the first one rptDly milliseconds after the press was validated, the next one rptPrdStrt milliseconds later, and the following ones with the period reduced by rptAcclStp milliseconds for each repeat, down to rptPrdMin.
+     * The repeat times are calculated from the time stamp of the poll that validated the press -i.e. after the debounce and the start delay-, not counted per poll, so the timing is kept accurate independently of the polling period. A single repeat is queued per poll, with it's own scheduled time: if the polls were delayed by more than a repeat period the missed repeats are not back-filled, the schedule being restarted from the current poll.
+     *
+     * @param rptDly Auto-repeat start delay in milliseconds. The value 0 disables the auto-repeat.
+     * @param rptPrdStrt Period between the first and second repeats in milliseconds, must be greater than 0 if the auto-repeat is enabled.
+     * @param rptPrdMin (Optional) Minimum period between repeats in milliseconds, must be in the range 0 < rptPrdMin <= rptPrdStrt. The value 0 -the default- sets it equal to rptPrdStrt, for a constant repeat rate.
+     * @param rptAcclStp (Optional) Reduction of the period applied after every repeat, in milliseconds. The value 0 -the default- produces a constant repeat rate.
+     *
+     * @retval true: The parameters were valid, the auto-repeat was configured.
+     * @retval false: The parameters were invalid, the configuration was not changed.
+     *
+     * @note The auto-repeat doesn't modify the object's state machine, the repeat events are generated while the press is valid, whatever the class behavior.
+     * @note If the method is invoked while a press is in progress, the press repeats are scheduled with the new settings from the last poll time, as if the press had started then.
+     */
+    bool setRpt(const unsigned long int &rptDly, const unsigned long int &rptPrdStrt = 0, const unsigned long int &rptPrdMin = 0, const unsigned long int &rptAcclStp = 0);
 };
 
 //==========================================================>>
@@ -593,7 +967,6 @@ protected:
 	volatile bool _validUnlatchPend{false};
 	volatile bool _validUnlatchRlsPend{false};
 
-	static void mpbPollCallback(TimerHandle_t mpbTmrCbArg);
 	virtual void stDisabled_In(){};
    virtual void stDisabled_Out(){};
 	virtual void stLtchNVUP_Do(){};
@@ -604,6 +977,7 @@ protected:
 	virtual void stOffVURP_Out(){};
    virtual void stOnNVRP_Do(){};
 	virtual void updFdaState();
+	virtual void updPollFlags();
 	virtual void updValidUnlatchStatus() = 0;
 public:
    /**
@@ -620,10 +994,12 @@ public:
 	 * For the rest of the parameters see DbncdMPBttn(GPIO_TypeDef*, const uint16_t, const bool, const bool, const unsigned long int)
 	 */
    LtchMPBttn(gpioPinId_t mpbttnPinStrct, const bool &pulledUp = true, const bool &typeNO = true, const unsigned long int &dbncTimeOrigSett = 0, const unsigned long int &strtDelay = 0);
+#ifndef MPB_BARE_METAL
    /**
 	 * @brief See DbncdMPBttn::begin(const unsigned long int)
     */
 	virtual bool begin(const unsigned long int &pollDelayMs = _StdPollDelay);
+#endif
 	/**
 	 * @brief See 	DbncdMPBttn::clrStatus(bool)
 	 */
@@ -665,8 +1041,10 @@ public:
 	const bool getUnlatchRlsPend() const;
 	/**
 	 * @brief See DbncdMPBttn::resetFda()
+	 *
+	 * The latch specific flags are cleared too, and the latching state machine is restarted.
 	 */
-	bool resetFda();
+	virtual void resetFda();
 	/**
 	 * @brief Sets the value of the trnOffASAP attribute flag.
 	 *
@@ -836,7 +1214,6 @@ protected:
 	bool _validPilotSetPend{false};
 	bool _validPilotResetPend{false};
 
-   static void mpbPollCallback(TimerHandle_t mpbTmrCbArg);
 	uint32_t _otptsSttsPkg(uint32_t prevVal = 0);
 	virtual void stDisabled_In();
 	virtual void stLtchNVUP_Do();
@@ -848,6 +1225,7 @@ protected:
 	void _turnOnPilot();
 	void _turnOnWrnng();
 	bool updPilotOn();
+	virtual void updPollFlags();
 	bool updWrnngOn();
 public:
 	/**
@@ -866,10 +1244,12 @@ public:
 	 * For the rest of the parameters see TmLtchMPBttn(gpioPinId_t, const unsigned long int, const bool, const bool, const unsigned long int, const unsigned long int)
 	 */
 	HntdTmLtchMPBttn(gpioPinId_t mpbttnPinStrct, const unsigned long int &actTime, const unsigned int &wrnngPrctg = 0, const bool &pulledUp = true, const bool &typeNO = true, const unsigned long int &dbncTimeOrigSett = 0, const unsigned long int &strtDelay = 0);
+#ifndef MPB_BARE_METAL
 	/**
 	 * @brief See DbncdMPBttn::begin(const unsigned long int)
 	 */
 	virtual bool begin(const unsigned long int &pollDelayMs = _StdPollDelay);
+#endif
    /**
     * @brief see DbncdMPBttn::clrStatus(bool)
     */
@@ -1012,8 +1392,11 @@ class XtrnUnltchMPBttn: public LtchMPBttn{
 
 protected:
     DbncdDlydMPBttn* _unLtchBttn {nullptr};
+    bool _unLtchBttnIsOn {false};
+    bool _unLtchBttnSbscrbd {false};
     bool _xtrnUnltchPRlsCcl {false};
 
+ 	virtual void _rcvPblshrChng(DbncdMPBttn* pblshr, const bool &pblshrIsOn);
  	virtual void stOffNVURP_Do();
  	virtual void updValidUnlatchStatus();
 public:
@@ -1029,6 +1412,8 @@ public:
  	 * @note For the other parameters see DbncdDlydMPBttn(GPIO_TypeDef*, const uint16_t, const bool, const bool, const unsigned long int, const unsigned long int)
  	 *
  	 * @note Other unlatch signal origins might be developed through the unlatch() method provided.
+ 	 *
+ 	 * @note The object subscribes to the unlatching object's isOn changes (see DbncdMPBttn::addSbscrbr(DbncdMPBttn*)). An object accepts up to _MpbSbscrbrsMaxQty subscribers, when the unlatching object's list is full the subscription fails and this object falls back to reading the unlatching object's getIsOn() in each of it's own polls, with the same behavior but without the same update cycle reaction.
  	 */
     XtrnUnltchMPBttn(GPIO_TypeDef* mpbttnPort, const uint16_t &mpbttnPin,  DbncdDlydMPBttn* unLtchBttn,
         const bool &pulledUp = true,  const bool &typeNO = true,  const unsigned long int &dbncTimeOrigSett = 0,  const unsigned long int &strtDelay = 0);
@@ -1045,6 +1430,8 @@ public:
   	 * @note For the other parameters see DbncdDlydMPBttn(gpioPinId_t, const bool, const bool, const unsigned long int, const unsigned long int)
   	 *
   	 * @note Other unlatch signal origins might be developed through the unlatch() method provided.
+  	 *
+  	 * @note See XtrnUnltchMPBttn(GPIO_TypeDef*, const uint16_t, DbncdDlydMPBttn*, const bool, const bool, const unsigned long int, const unsigned long int) for the unlatching object subscription limit.
   	 */
     XtrnUnltchMPBttn(gpioPinId_t mpbttnPinStrct,  DbncdDlydMPBttn* unLtchBttn,
         const bool &pulledUp = true,  const bool &typeNO = true,  const unsigned long int &dbncTimeOrigSett = 0,  const unsigned long int &strtDelay = 0);
@@ -1069,10 +1456,18 @@ public:
     XtrnUnltchMPBttn(gpioPinId_t mpbttnPinStrct,
    		const bool &pulledUp = true,  const bool &typeNO = true,  const unsigned long int &dbncTimeOrigSett = 0,  const unsigned long int &strtDelay = 0);
 
+    /**
+     * @brief Class virtual destructor
+     *
+     * The object is unsubscribed from it's unlatching object.
+     */
+    virtual ~XtrnUnltchMPBttn();
+#ifndef MPB_BARE_METAL
     /**
      * @brief See DbncdMPBttn::begin(const unsigned long int)
      */
     virtual bool begin(const unsigned long int &pollDelayMs = _StdPollDelay);
+#endif
     /**
      * @brief See DbncdMPBttn::clrStatus(bool)
      */
@@ -1128,9 +1523,10 @@ protected:
 
 	void (*_fnWhnTrnOffScndry)() {nullptr};
 	void (*_fnWhnTrnOnScndry)() {nullptr};
+#ifndef MPB_BARE_METAL
 	TaskHandle_t _taskWhileOnScndryHndl{NULL};
+#endif
 
-	static void mpbPollCallback(TimerHandle_t mpbTmrCbArg);
 	uint32_t _otptsSttsPkg(uint32_t prevVal = 0);
    virtual void stDisabled_In(){};
    virtual void stOnEndScndMod_Out(){};
@@ -1139,6 +1535,7 @@ protected:
 	virtual void _turnOffScndry();
 	virtual void _turnOnScndry();
 	virtual void updFdaState();
+	virtual void updPollFlags();
 	virtual bool updValidPressesStatus();
    virtual void updValidUnlatchStatus();
 
@@ -1159,11 +1556,13 @@ public:
 	 * @brief Virtual destructor
     */
 	~DblActnLtchMPBttn();
+#ifndef MPB_BARE_METAL
 	/**
 	 *
 	 * @brief See DbncdMPBttn::begin(const unsigned long int)
 	 */
    virtual bool begin(const unsigned long int &pollDelayMs = _StdPollDelay);
+#endif
 	/**
 	 * @brief See DbncddMPBttn::clrStatus(bool)
 	 */
@@ -1202,6 +1601,7 @@ public:
 	 * @return The current scndModActvDly value, i.e. the delay in milliseconds.
 	 */
    unsigned long getScndModActvDly();
+#ifndef MPB_BARE_METAL
 	/**
 	 * @brief Returns the task to be run while the object is in the **Secondary On state**.
 	 *
@@ -1213,6 +1613,13 @@ public:
     * @warning Free-RTOS has no mechanism implemented to notify a task that it is about to be set in **paused** state, so there is no way to that task to ensure it will be set to pause in an orderly fashion. The task to be designated to be used by this mechanism has to be task that can withstand being interrupted at any point of it's execution, and be restarted from that same point next time the **isOnScndry** flag is set. For tasks that might need attaching resources or other issues every time it is resumed and releasing resources of any kind before being **paused**, using the function attached by using **setFnWhnTrnOnScndryPtr()** to gain control of the resources before resuming a task, and the function attached by using **setFnWhnTrnOffScndryPtr()** to release the resources and pause the task in an orderly fashion, or use those functions to manage a binary semaphore for managing the execution of a task.
 	 */
 	const TaskHandle_t getTaskWhileOnScndry();
+#endif
+	/**
+	 * @brief See LtchMPBttn::resetFda()
+	 *
+	 * The secondary mode flags and timer are cleared too, the secondary output is reset and the double action state machine is restarted.
+	 */
+	virtual void resetFda();
 	/**
 	 * @brief Sets the function that will be called to execute every time the object **enters** the **Secondary Off State**.
 	 *
@@ -1240,6 +1647,7 @@ public:
 	 * @retval false: The new value is not in the valid range, the value was not updated.
 	 */
 	bool setScndModActvDly(const unsigned long &newVal);
+#ifndef MPB_BARE_METAL
 	/**
 	 * @brief Sets the task to be run while the object is in the **On state**.
 	 *
@@ -1258,6 +1666,7 @@ public:
     * @warning Take special consideration about the implications of the execution **priority** of the task to be executed while the MPB is in **On state** and its relation to the priority of the calling task, as it might affect the normal execution of the application.
 	 */
 	void setTaskWhileOnScndry(const TaskHandle_t &newTaskHandle);
+#endif
 };
 
 //==========================================================>>
@@ -1320,6 +1729,12 @@ public:
  * - Automatically revert direction when reaching the minimum and maximum values setting.
  * - Revert direction by methods invocation (see setSldrDirDn(), setSldrDirUp(), swapSldrDir()).
  *
+ * The slider might work in **lazy mode** (see setSldrLzy()): instead of accumulating the value changes poll by poll, only the ramp origin -start time, start value and direction- is kept, and the otptCurVal is calculated exactly from it when a step is due, including the direction swaps at the range ends. The ramp timing becomes independent of the polling period, and no calculations are made in the polls between steps.
+ *
+ * The otptCurVal changes notifications might be throttled while the slider is ramping (see setSldrNtfMinPrd() and setSldrNtfMinDlt()), limiting the notifications rate and ignoring small value changes, while ensuring the final value is always notified when the slider stops.
+ *
+ * The otptCurVal register might be bound to a PWM timer Capture/Compare register (CCR) -or any other 32 bits register, including a host stand-in variable- by setPwmCcr(). Every otptCurVal change is then written to the register as part of the slider update, scaled to the PWM period and optionally corrected through a gamma lookup table (see setPwmGmmTbl()), for smooth dimming with no consumer task involved.
+ *
  * class SldrDALtchMPBttn
  */
 class SldrDALtchMPBttn: public DblActnLtchMPBttn{
@@ -1334,13 +1749,47 @@ protected:
 	uint16_t _otptSldrStpSize{0x01};
 	uint16_t _otptValMax{0xFFFF};
 	uint16_t _otptValMin{0x0000};
+	uint32_t _pwmCcrMax{0xFFFF};
+	volatile uint32_t* _pwmCcrReg{nullptr};
+	const uint16_t* _pwmGmmTbl{nullptr};
+	uint16_t _pwmGmmTblSize{0};
+	unsigned long _sldrAcclNxtTm{0};
+	uint8_t _sldrAcclFctr{1};
+	uint8_t _sldrAcclMaxFctr{1};
+	unsigned long _sldrAcclPrd{0};
+	uint8_t _sldrExpShft{0};
+	bool _sldrLzy{false};
+	unsigned long _sldrLzyNxtTm{0};
+	unsigned long _sldrLzyStpTm{0};
+	bool _sldrOrgnDirUp{true};
+	unsigned long _sldrOrgnTm{0};
+	uint16_t _sldrOrgnVal{0};
+	uint32_t _sldrLutIdxFctr{0};
+	const uint16_t* _sldrLutTbl{nullptr};
+	uint8_t _sldrLutTblSize{0};
+	unsigned long _sldrLstNtfTm{0};
+	uint16_t _sldrLstNtfVal{0};
+	uint16_t _sldrNtfMinDlt{0};
+	unsigned long _sldrNtfMinPrd{0};
+	bool _sldrNtfPend{false};
+	unsigned long _sldrNxtStpTm{0};
+	SldrRmpPrfl_t _sldrRmpPrfl{rmpLnr};
 
+	uint32_t _clcPwmCcrVal(uint16_t otptVal, const uint32_t &ccrMax);
 	uint32_t _otptsSttsPkg(uint32_t prevVal = 0);
 	bool _setSldrDir(const bool &newVal);
+	void _sldrLzyRbs();
+	uint16_t _sldrLzyVal(const unsigned long &stpsQty, bool &dirUp);
+	void _sldrNtfFlsh();
+	void _sldrRmpRst();
+	uint32_t _sldrRmpStpSz();
+	void _updSldrLutIdxFctr();
    virtual void stDisabled_In();
    void stOnEndScndMod_Out();
    virtual void stOnScndMod_Do();
 	virtual void stOnStrtScndMod_In();
+	virtual void _wrtAllPwmCcr();
+	virtual void _wrtPwmCcr();
 public:
    /**
 	 * @brief Class constructor
@@ -1389,6 +1838,14 @@ public:
     * @retval false: The **Output Current Value** is **not** equal to the **Minimum value setting**.
     */
    bool getOtptCurValIsMin();
+	/**
+	 * @brief Returns the value corresponding to the current otptCurVal to be written to the bound PWM CCR register.
+	 *
+	 * The otptCurVal position in the [otptValMin, otptValMax] range is mapped to the [0, ccrMax] range, through the gamma lookup table if one is set.
+	 *
+	 * @return The CCR register value, calculated even if no register is bound.
+	 */
+	const uint32_t getPwmCcrVal();
 	/**
 	 * @brief Returns the current setting for the **Output Slider Speed** value.
 	 *
@@ -1431,6 +1888,31 @@ public:
 	 * @retval false The current slider direction is **Down**, the output current value will be decremented.
 	 */
 	bool getSldrDirUp();
+	/**
+	 * @brief Returns the value of the sldrLzy attribute
+	 *
+	 * @retval true The slider works in lazy mode, see setSldrLzy(const bool &).
+	 * @retval false The slider works in the per poll accumulation mode.
+	 */
+	bool getSldrLzy();
+	/**
+	 * @brief Returns the minimum otptCurVal change to be notified while the slider is ramping
+	 *
+	 * @return The minimum notified value change, see setSldrNtfMinDlt(const uint16_t &).
+	 */
+	uint16_t getSldrNtfMinDlt();
+	/**
+	 * @brief Returns the minimum time between otptCurVal change notifications while the slider is ramping
+	 *
+	 * @return The minimum notifications period in milliseconds, see setSldrNtfMinPrd(const unsigned long &).
+	 */
+	unsigned long getSldrNtfMinPrd();
+	/**
+	 * @brief Returns the ramp profile in use for the otptCurVal changes
+	 *
+	 * @return The ramp profile, see SldrRmpPrfl_t.
+	 */
+	SldrRmpPrfl_t getSldrRmpPrfl();
 	/**
 	 * @brief Sets the output current value register.
 	 *
@@ -1507,6 +1989,44 @@ public:
 	 * @warning If the otptValMin attribute intended change is to a greater value, the otptCurVal might be left outside the new valid range (newVal > otptCurVal). In this case the otptCurVal will be changed to be equal to newVal, and so otptCurVal will become equal to otptValMin.
 	 */
 	bool setOtptValMin(const uint16_t &newVal);
+	/**
+	 * @brief Binds the otptCurVal register to a PWM timer Capture/Compare register.
+	 *
+	 * Once bound, every otptCurVal change -by the slider or by any of the setters- writes the scaled value to the register (see getPwmCcrVal()). The register is written at binding time too.
+	 *
+	 * @param ccrReg Pointer to the register to write: a timer CCRx register, or a host stand-in variable. A nullptr value removes the binding.
+	 * @param ccrMax (Optional) The value corresponding to a 100% duty cycle -usually the timer ARR register value-. The default value is 0xFFFF.
+	 *
+	 * @retval true: The binding was set or removed.
+	 * @retval false: The ccrMax parameter was 0, the binding was not changed.
+	 */
+	bool setPwmCcr(volatile uint32_t* ccrReg, const uint32_t &ccrMax = 0xFFFF);
+#ifdef HAL_TIM_MODULE_ENABLED
+	/**
+	 * @brief Binds the otptCurVal register to a PWM channel of a HAL TIM timer.
+	 *
+	 * The CCR register of the channel is bound, the 100% duty cycle value is taken from the timer current auto-reload (ARR) register value. The PWM channel must be configured and started by the application (i.e. HAL_TIM_PWM_Start()).
+	 *
+	 * @param htim Pointer to the HAL timer handle.
+	 * @param tmChnnl The timer channel: TIM_CHANNEL_1, TIM_CHANNEL_2, TIM_CHANNEL_3 or TIM_CHANNEL_4.
+	 *
+	 * @retval true: The binding was set.
+	 * @retval false: The parameters were invalid or the auto-reload value is 0, the binding was not changed.
+	 */
+	bool setPwmCcr(TIM_HandleTypeDef* htim, const uint32_t &tmChnnl);
+#endif
+	/**
+	 * @brief Sets a gamma correction lookup table for the PWM CCR bound register values.
+	 *
+	 * The table entries are the output values, in the [0, 0xFFFF] range, for equally spaced points of the [otptValMin, otptValMax] range, the first entry corresponding to otptValMin and the last one to otptValMax. The values between points are linearly interpolated, and the result is scaled to the [0, ccrMax] range.
+	 *
+	 * @param gmmTbl Pointer to the lookup table, that must remain valid while set. A nullptr value removes the table, and a linear mapping is used.
+	 * @param gmmTblSize Number of entries in the table, at least 2.
+	 *
+	 * @retval true: The table was set or removed.
+	 * @retval false: The table size was invalid, the table was not changed.
+	 */
+	bool setPwmGmmTbl(const uint16_t* gmmTbl, const uint16_t &gmmTblSize);
 	/**
 	 * @brief Sets the value of the curSldrDirUp attribute to false.
 	 *
@@ -1520,6 +2040,74 @@ public:
 	 * @retval true The change of direction failed as the otptCurVal was equal to the extreme value
 	 */
 	bool setSldrDirDn();
+	/**
+	 * @brief Sets the value of the sldrLzy attribute, that selects the slider lazy mode.
+	 *
+	 * In lazy mode the slider keeps the ramp origin -the time, otptCurVal value and direction at the start of the ramp- and the otptCurVal is calculated from it as: origin value +/- (elapsed time / otptSldrSpd) * otptSldrStpSize, the direction swaps at the range ends -if autoSwpDirOnEnd is set- being calculated analytically too. The calculation is made only in the polls in which a new step is due, the rest of the polls just compare the current time against the next step time.
+	 * The ramp origin is rebased every time a slider parameter -value, direction, speed, step size or range limits- is changed during the ramp.
+	 *
+	 * @param newVal The new value for the sldrLzy attribute. The mode might be changed while the slider is in secondary mode.
+	 */
+	void setSldrLzy(const bool &newVal);
+	/**
+	 * @brief Sets the minimum otptCurVal change to be notified while the slider is ramping (the notifications deadband).
+	 *
+	 * While the slider is ramping, an otptCurVal change is notified only if the value differs from the last notified value by newVal or more, or if the value reached one of the range limits. The changes not notified are kept pending, and the last value is always notified when the slider stops.
+	 *
+	 * @param newVal The minimum notified value change. The value 0 -the instantiation default- disables the deadband.
+	 *
+	 * @note The PWM Capture/Compare bound register -if set- is written on every value change, the throttling applies to the notifications only.
+	 */
+	void setSldrNtfMinDlt(const uint16_t &newVal);
+	/**
+	 * @brief Sets the minimum time between otptCurVal change notifications while the slider is ramping (the notifications rate limit).
+	 *
+	 * While the slider is ramping, an otptCurVal change is notified only if at least newVal milliseconds elapsed since the last notification. The changes not notified are kept pending, to be notified as soon as the period elapses, and the last value is always notified when the slider stops.
+	 *
+	 * @param newVal The minimum notifications period in milliseconds. The value 0 -the instantiation default- disables the rate limit.
+	 */
+	void setSldrNtfMinPrd(const unsigned long &newVal);
+	/**
+	 * @brief Sets the accelerating ramp profile for the otptCurVal changes.
+	 *
+	 * The step size applied at each step is otptSldrStpSize multiplied by an acceleration factor. The factor starts as 1 every time the secondary mode is entered, and is incremented by one every acclPrd milliseconds of hold time, up to acclMaxFctr.
+	 *
+	 * @param acclPrd Hold time in milliseconds between acceleration factor increments, must be greater than 0.
+	 * @param acclMaxFctr Maximum value of the acceleration factor, must be greater than 1.
+	 *
+	 * @retval true: The parameters were valid, the profile was set.
+	 * @retval false: The parameters were invalid, the profile was not changed.
+	 *
+	 * @note The non linear profiles are evaluated step by step, with integer only operations. The lazy mode (see setSldrLzy(const bool &)) applies to the linear profile only.
+	 */
+	bool setSldrRmpAccl(const unsigned long &acclPrd, const uint8_t &acclMaxFctr);
+	/**
+	 * @brief Sets the exponential ramp profile for the otptCurVal changes.
+	 *
+	 * The step size applied at each step is ((otptCurVal - otptValMin) >> expShft) + otptSldrStpSize, so the value changes by a constant fraction of it's position in the range: in fine steps at the low end of the range and in coarse steps at the high end, in both directions. The perceived result is a logarithmic scale response, as needed for dimmers and volume controls.
+	 *
+	 * @param expShft The fraction of the position in the range added to each step, as a power of 2 divisor (i.e. 4 means 1/16 of the position in each step). The valid range is 1 <= expShft <= 15.
+	 *
+	 * @retval true: The parameter was valid, the profile was set.
+	 * @retval false: The parameter was invalid, the profile was not changed.
+	 */
+	bool setSldrRmpExp(const uint8_t &expShft);
+	/**
+	 * @brief Sets the linear ramp profile for the otptCurVal changes, the instantiation default profile.
+	 */
+	void setSldrRmpLnr();
+	/**
+	 * @brief Sets the lookup table ramp profile for the otptCurVal changes.
+	 *
+	 * The [otptValMin, otptValMax] range is divided in as many equal segments as the table entries, and the step size applied at each step is the table entry corresponding to the segment the otptCurVal is in, so any curve might be defined as a succession of slopes.
+	 *
+	 * @param stpsTbl Pointer to the step sizes table, that must remain valid while set. All the entries must be greater than 0.
+	 * @param stpsTblSize Number of entries of the table, must be greater than 0.
+	 *
+	 * @retval true: The parameters were valid, the profile was set.
+	 * @retval false: The parameters were invalid, the profile was not changed.
+	 */
+	bool setSldrRmpLut(const uint16_t* stpsTbl, const uint8_t &stpsTblSize);
 	/**
 	 * @brief Sets the value of the curSldrDirUp attribute to true
 	 *
@@ -1565,58 +2153,217 @@ public:
 //==========================================================>>
 
 /**
- * @brief Abstract class, base to model Voidable DD-MPBs (**VDD-MPB**).
+ * @brief Models a Multi-Channel Slider Double Action LDD-MPB combo switch, a.k.a. off/on/color/dimmer switch (**MCS-DALDD-MPB**)
  *
- * **Voidable DD-MPBs** are MPBs whose distinctive characteristic is that implement non-latching switches that while being pressed their state might change from **On State** to a **Voided state** due to different voiding conditions. Depending on the classes the voided state might be **Voided & Off state**, **Voided & On state** or **Voided & Not enforced** states.
- * Those conditions to change to a voided state include -but are not limited to- the following conditions:
- * - pressing time
- * - external signals
- * - entering the **On state**
+ * This is a subclass of the **S-DALDD-MPB** that keeps several independent output values -the **channels**- driven by a single MPB, as needed for RGB or tunable white fixtures (i.e. hue and brightness, or color temperature and brightness).
+ * The slider secondary mode modifies the value of the **active channel**, each channel keeping it's own value and slider direction. If the **autoChngChnl** attribute is set -the instantiation default- the next channel becomes the active channel every time the secondary mode ends, so consecutive long presses cycle through the channels ramping one after the other. The active channel might also be selected by setActvChnl(const uint8_t &).
+ * The otptCurVal attribute and all the slider configuration and behavior belong to the active channel, the range, speed, step size and ramp profile settings being shared by all the channels.
  *
- * The mechanisms to "un-void" the MPB and return it to an operational state include -but are not limited to- the following actions:
- * - releasing the MPBs
- * - receiving an external signal
- * - the reading of the **isOn** attribute flag status
+ * All the channels values are delivered together, packed in a 64 bits word (see getChnlsPkgd()), by a single notification for each change: to the function set by setFnWhnChnlsChngPtr(void (*)(uint64_t)) and -through the packed output word active channel field- to the task set to be notified, that might read the package. This avoids the N objects, N timers and N notifications for each step needed to keep N synchronized SldrDALtchMPBttn objects.
  *
- * The voiding conditions and the un-voiding mechanisms define the VDD-MPB subclasses.
+ * @note Each channel has it's own PWM Capture/Compare register binding -see setPwmCcr(const uint8_t &, volatile uint32_t*, const uint32_t &)-, the inherited SldrDALtchMPBttn::setPwmCcr(volatile uint32_t*, const uint32_t &) binding being the channel 0 one. A bound register is written only with it's channel value, and only when that value -or the range or gamma settings- change, so changing the active channel doesn't move the other channels outputs.
  *
- * @class VdblMPBttn
+ * class MltChnlSldrDALtchMPBttn
  */
-class VdblMPBttn: public DbncdDlydMPBttn{
-private:
-   void setFrcdOtptWhnVdd(const bool &newVal);
-   void setStOnWhnOtpFrcd(const bool &newVal);
-protected:
-	enum fdaVmpbStts{
- 		stOffNotVPP,
- 		stOffVPP,
- 		stOnNVRP,
-		//--------
-		stOnVVP,
-		stOnVddNVUP,
-		stOffVddNVUP,
-		stOffVddVUP,
-		stOffUnVdd,
-		//--------
- 		stOnVRP,
-		stOnTurnOff,
-		stOff,
-		//--------
-		stDisabled
- 	};
- 	fdaVmpbStts _mpbFdaState {stOffNotVPP};
+class MltChnlSldrDALtchMPBttn: public SldrDALtchMPBttn{
 
-	void (*_fnWhnTrnOffVdd)() {nullptr};
-	void (*_fnWhnTrnOnVdd)() {nullptr};
-	bool _frcOtptLvlWhnVdd {true};
-	bool _isVoided{false};
-   bool _stOnWhnOtptFrcd{false};
-   bool _validVoidPend{false};
-   bool _validUnvoidPend{false};
+protected:
+	uint8_t _actvChnl{0};
+	bool _autoChngChnl{true};
+	uint8_t _chnlsCnt{1};
+	uint32_t _chnlsCcrMax[_MltChnlSldrMaxChnls]{};	//The channel 0 binding is kept in the inherited _pwmCcrMax and _pwmCcrReg attributes
+	volatile uint32_t* _chnlsCcrReg[_MltChnlSldrMaxChnls]{};
+	bool _chnlsDirUp[_MltChnlSldrMaxChnls]{};
+	uint16_t _chnlsVal[_MltChnlSldrMaxChnls]{};
+	fncChnlsChngPtrType _fnWhnChnlsChng{nullptr};
 
-   static void mpbPollCallback(TimerHandle_t mpbTmrCb);
-   uint32_t _otptsSttsPkg(uint32_t prevVal = 0);
-   bool setVoided(const bool &newVoidValue);
+	void _ldActvChnl();
+	void _notifyOtptsChng();
+	uint32_t _otptsSttsPkg(uint32_t prevVal = 0);
+	void _svActvChnl();
+	void stOnEndScndMod_Out();
+	virtual void stOnScndMod_Do();
+	virtual void _wrtAllPwmCcr();
+	void _wrtChnlPwmCcr(const uint8_t &chnl);
+	virtual void _wrtPwmCcr();
+public:
+	using SldrDALtchMPBttn::setPwmCcr;
+	/**
+	 * @brief Class constructor
+	 *
+	 * @param chnlsCnt (Optional) Number of channels, in the range 1 <= chnlsCnt <= _MltChnlSldrMaxChnls, out of range values are adjusted to the nearest valid value. If no value is provided 2 channels are configured.
+	 * @param initVal (Optional) Initial value of all the channels. If no value is provided 0xFFFF will be the instantiation value.
+	 *
+	 * @note For the remaining parameters see SldrDALtchMPBttn(GPIO_TypeDef*, const uint16_t, const bool, const bool, const unsigned long int, const unsigned long int, const uint16_t)
+	 */
+	MltChnlSldrDALtchMPBttn(GPIO_TypeDef* mpbttnPort, const uint16_t &mpbttnPin, const bool &pulledUp = true, const bool &typeNO = true, const unsigned long int &dbncTimeOrigSett = 0, const unsigned long int &strtDelay = 0, const uint8_t &chnlsCnt = 2, const uint16_t initVal = 0xFFFF);
+	/**
+	 * @brief Class constructor
+	 *
+	 * @param mpbttnPinStrct GPIO port and Pin identification defined as a single gpioPinId_t parameter.
+	 *
+	 * @note For the remaining parameters and considerations see MltChnlSldrDALtchMPBttn(GPIO_TypeDef*, const uint16_t, const bool, const bool, const unsigned long int, const unsigned long int, const uint8_t, const uint16_t)
+	 */
+	MltChnlSldrDALtchMPBttn(gpioPinId_t mpbttnPinStrct, const bool &pulledUp = true, const bool &typeNO = true, const unsigned long int &dbncTimeOrigSett = 0, const unsigned long int &strtDelay = 0, const uint8_t &chnlsCnt = 2, const uint16_t initVal = 0xFFFF);
+	/**
+	 * @brief Class virtual destructor
+	 */
+	~MltChnlSldrDALtchMPBttn();
+	/**
+	 * @brief Returns the index of the active channel, the channel modified by the slider.
+	 *
+	 * @return The active channel index, in the range 0 <= index < chnlsCnt.
+	 */
+	const uint8_t getActvChnl() const;
+	/**
+	 * @brief Returns the value of the autoChngChnl attribute
+	 *
+	 * @retval true The next channel becomes the active channel every time the secondary mode ends.
+	 * @retval false The active channel is changed only by setActvChnl(const uint8_t &).
+	 */
+	const bool getAutoChngChnl() const;
+	/**
+	 * @brief Returns the number of channels of the object
+	 *
+	 * @return The number of channels.
+	 */
+	const uint8_t getChnlsCnt() const;
+	/**
+	 * @brief Returns all the channels values packed in a single 64 bits word.
+	 *
+	 * Each channel value occupies 16 bits, the channel 0 value in the 16 least significant bits, the channel 1 value in the next 16 bits, and so on. The bits corresponding to non existent channels are set to 0. The package is built as a critical section, so a coherent set of values is returned.
+	 *
+	 * @return The packed channels values.
+	 */
+	uint64_t getChnlsPkgd();
+	/**
+	 * @brief Returns the value of a channel
+	 *
+	 * @param chnl The channel index.
+	 *
+	 * @return The channel value, 0 if the channel index is not valid.
+	 */
+	uint16_t getChnlVal(const uint8_t &chnl);
+	/**
+	 * @brief Returns the function set to be executed when the channels values change.
+	 *
+	 * @return A pointer to the function, nullptr if no function is set.
+	 */
+	fncChnlsChngPtrType getFnWhnChnlsChng();
+	/**
+	 * @brief Sets the active channel, the channel to be modified by the slider.
+	 *
+	 * The current otptCurVal and slider direction are kept as the previously active channel values, and the new active channel values are loaded. If the change is made while the slider is in secondary mode, the ramp continues with the new channel.
+	 *
+	 * @param newVal The new active channel index.
+	 *
+	 * @retval true: The index was valid, the active channel was set.
+	 * @retval false: The index was invalid, the active channel was not changed.
+	 */
+	bool setActvChnl(const uint8_t &newVal);
+	/**
+	 * @brief Sets the value of the autoChngChnl attribute
+	 *
+	 * @param newVal The new value for the autoChngChnl attribute, see getAutoChngChnl().
+	 */
+	void setAutoChngChnl(const bool &newVal);
+	/**
+	 * @brief Sets the value of a channel
+	 *
+	 * @param chnl The channel index.
+	 * @param newVal The new value for the channel, in the range otptValMin <= newVal <= otptValMax.
+	 *
+	 * @retval true: The parameters were valid, the value was set.
+	 * @retval false: The parameters were invalid, the value was not changed.
+	 */
+	bool setChnlVal(const uint8_t &chnl, const uint16_t &newVal);
+	/**
+	 * @brief Sets a function to be executed when the channels values change.
+	 *
+	 * The function is executed once for each update in which any attribute flag or channel value changed, receiving the packed channels values (see getChnlsPkgd()) as parameter, just before the outputs change function and the task notification of the parent classes.
+	 *
+	 * @param newFnWhnChnlsChng Pointer to the function, nullptr to remove the function.
+	 */
+	void setFnWhnChnlsChngPtr(void (*newFnWhnChnlsChng)(uint64_t));
+	/**
+	 * @brief Binds a channel value to a PWM timer Capture/Compare register.
+	 *
+	 * Once bound, every change of the channel value writes the scaled value to the register, the register is written at binding time too. The channel 0 binding is the one set by SldrDALtchMPBttn::setPwmCcr(volatile uint32_t*, const uint32_t &).
+	 *
+	 * @param chnl The channel index.
+	 * @param ccrReg Pointer to the register to write, a nullptr value removes the binding.
+	 * @param ccrMax (Optional) The value corresponding to a 100% duty cycle. The default value is 0xFFFF.
+	 *
+	 * @retval true: The binding was set or removed.
+	 * @retval false: The channel index was invalid or the ccrMax parameter was 0, the binding was not changed.
+	 */
+	bool setPwmCcr(const uint8_t &chnl, volatile uint32_t* ccrReg, const uint32_t &ccrMax = 0xFFFF);
+#ifdef HAL_TIM_MODULE_ENABLED
+	/**
+	 * @brief Binds a channel value to a PWM channel of a HAL TIM timer.
+	 *
+	 * @param chnl The channel index.
+	 *
+	 * @note For the remaining parameters and considerations see SldrDALtchMPBttn::setPwmCcr(TIM_HandleTypeDef*, const uint32_t &)
+	 */
+	bool setPwmCcr(const uint8_t &chnl, TIM_HandleTypeDef* htim, const uint32_t &tmChnnl);
+#endif
+};
+
+//==========================================================>>
+
+/**
+ * @brief Abstract class, base to model Voidable DD-MPBs (**VDD-MPB**).
+ *
+ * **Voidable DD-MPBs** are MPBs whose distinctive characteristic is that implement non-latching switches that while being pressed their state might change from **On State** to a **Voided state** due to different voiding conditions. Depending on the classes the voided state might be **Voided & Off state**, **Voided & On state** or **Voided & Not enforced** states.
+ * Those conditions to change to a voided state include -but are not limited to- the following conditions:
+ * - pressing time
+ * - external signals
+ * - entering the **On state**
+ *
+ * The mechanisms to "un-void" the MPB and return it to an operational state include -but are not limited to- the following actions:
+ * - releasing the MPBs
+ * - receiving an external signal
+ * - the reading of the **isOn** attribute flag status
+ *
+ * The voiding conditions and the un-voiding mechanisms define the VDD-MPB subclasses.
+ *
+ * @class VdblMPBttn
+ */
+class VdblMPBttn: public DbncdDlydMPBttn{
+private:
+   void setFrcdOtptWhnVdd(const bool &newVal);
+   void setStOnWhnOtpFrcd(const bool &newVal);
+protected:
+	enum fdaVmpbStts{
+ 		stOffNotVPP,
+ 		stOffVPP,
+ 		stOnNVRP,
+		//--------
+		stOnVVP,
+		stOnVddNVUP,
+		stOffVddNVUP,
+		stOffVddVUP,
+		stOffUnVdd,
+		//--------
+ 		stOnVRP,
+		stOnTurnOff,
+		stOff,
+		//--------
+		stDisabled
+ 	};
+ 	fdaVmpbStts _mpbFdaState {stOffNotVPP};
+
+	void (*_fnWhnTrnOffVdd)() {nullptr};
+	void (*_fnWhnTrnOnVdd)() {nullptr};
+	bool _frcOtptLvlWhnVdd {true};
+	bool _isVoided{false};
+   bool _stOnWhnOtptFrcd{false};
+   bool _validVoidPend{false};
+   bool _validUnvoidPend{false};
+
+   uint32_t _otptsSttsPkg(uint32_t prevVal = 0);
+   bool setVoided(const bool &newVoidValue);
    virtual void stDisabled_In();
    virtual void stDisabled_Out();
    virtual void stOffNotVPP_In(){};
@@ -1625,6 +2372,7 @@ protected:
 	void _turnOffVdd();
 	void _turnOnVdd();
    virtual void updFdaState();
+   virtual void updPollFlags();
    virtual bool updVoidStatus() = 0;
 public:
     /**
@@ -1775,10 +2523,12 @@ public:
      * @brief Class virtual destructor
      */
     virtual ~TmVdblMPBttn();
+#ifndef MPB_BARE_METAL
     /**
      * @brief See DbncdMPBttn::begin(const unsigned long int)
      */
     virtual bool begin(const unsigned long int &pollDelayMs = _StdPollDelay);
+#endif
     /**
      * @brief See DbncdMPBttn::clrStatus(bool)
      */
@@ -1823,7 +2573,9 @@ public:
  */
 class SnglSrvcVdblMPBttn: public VdblMPBttn{
 protected:
+#ifndef MPB_BARE_METAL
 	virtual void setTaskWhileOn(const TaskHandle_t &newTaskHandle);
+#endif
    virtual void stOffVddNVUP_Do();	//This provides the calculation for the _validUnvoidPend
    virtual bool updVoidStatus();
 public:
@@ -1843,10 +2595,2038 @@ public:
     * @brief Class virtual destructor
     */
    virtual ~SnglSrvcVdblMPBttn();
+#ifndef MPB_BARE_METAL
    /**
     * @brief See DbncdMPBttn::begin(const unsigned long int)
     */
    virtual bool begin(const unsigned long int &pollDelayMs = _StdPollDelay);
+#endif
+};
+
+//==========================================================>>
+
+/**
+ * @brief Models a quadrature Rotary Encoder with it's push button, the push button being a Debounced Delayed MPB (**DD-MPB**)
+ *
+ * The encoder A and B channels are sampled -in the same poll cycle than the push button, or by an external interrupt- and decoded by a table-driven state machine: each valid transition of the channels pair is a quarter step forward or backward, the invalid transitions (both channels changing between samples) are discarded and counted. Contact bounces produce back and forth transitions that cancel themselves, so no channel debouncing is needed. The quarter steps are accumulated into **detents**, each detent changing the **otptCurVal** value by the configured step size, inside the [otptValMin, otptValMax] range, saturating at the limits or wrapping around.
+ *
+ * The otptCurVal changes are notified by the same mechanisms as the push button output flags changes: the outputsChange flag, the outputs change function and the task notification, the value being included in the packed outputs word (see getOtptsSttsPkgd()).
+ *
+ * The encoder **velocity** is calculated from the time between consecutive detents, in detents per second.
+ *
+ * The channels might be sampled:
+ * - **Polled**: the channels are sampled in every update of the object, the polling period must be shorter than the time between the channels transitions at the maximum expected rotation speed (i.e. 1 ms polling for 60 detents per second for a 4 quarter steps per detent encoder).
+ * - **EXTI**: the channels pins are configured to generate external interrupts on both edges, and the encdrIsr(const unsigned long int &) method must be invoked from the HAL_GPIO_EXTI_Callback() function when the pin received is one of the channels pins. The push button is still polled.
+ *
+ * @class RtryEncdrMPBttn
+ */
+class RtryEncdrMPBttn: public DbncdDlydMPBttn{
+protected:
+	static const int8_t _encdrTbl[16];
+
+	gpioPinId_t _encdrAPin{};
+	gpioPinId_t _encdrBPin{};
+	uint32_t _encdrErrsCnt{0};
+	bool _encdrExti{false};
+	uint8_t _encdrSt{0};
+	int32_t _dtntsCnt{0};
+	unsigned long int _lstDtntTm{0};
+	uint16_t _otptCurVal{0};
+	uint16_t _otptStpSize{1};
+	uint16_t _otptValMax{0xFFFF};
+	uint16_t _otptValMin{0};
+	bool _otptWrp{false};
+	int8_t _qrtrStps{0};
+	uint8_t _stpsPerDtnt{4};
+	int32_t _vlcty{0};
+
+	void _encdrCfgPins();
+	uint32_t _otptsSttsPkg(uint32_t prevVal = 0);
+	uint8_t _rdEncdr();
+	void _updEncdr(const unsigned long int &curTm);
+	virtual void updFdaState();
+	virtual void updPollFlags();
+public:
+	/**
+	 * @brief Class constructor
+	 *
+	 * @param mpbttnPort GPIO port identification of the push button input pin.
+	 * @param mpbttnPin Pin id number of the push button input pin.
+	 * @param encdrAPin GPIO pin of the encoder A channel.
+	 * @param encdrBPin GPIO pin of the encoder B channel.
+	 * @param pulledUp (Optional) See DbncdMPBttn(GPIO_TypeDef*, const uint16_t, const bool, const bool, const unsigned long int), applies to the push button pin and to the channels pins, a channel contact being closed when it's pin is at the opposite level.
+	 *
+	 * For the rest of the parameters see DbncdDlydMPBttn(GPIO_TypeDef*, const uint16_t, const bool, const bool, const unsigned long int, const unsigned long int)
+	 */
+	RtryEncdrMPBttn(GPIO_TypeDef* mpbttnPort, const uint16_t &mpbttnPin, gpioPinId_t encdrAPin, gpioPinId_t encdrBPin, const bool &pulledUp = true, const bool &typeNO = true, const unsigned long int &dbncTimeOrigSett = 0, const unsigned long int &strtDelay = 0);
+	/**
+	 * @brief Class constructor
+	 *
+	 * @note For the parameters see RtryEncdrMPBttn(GPIO_TypeDef*, const uint16_t &, gpioPinId_t, gpioPinId_t, const bool &, const bool &, const unsigned long int &, const unsigned long int &)
+	 */
+	RtryEncdrMPBttn(gpioPinId_t mpbttnPinStrct, gpioPinId_t encdrAPin, gpioPinId_t encdrBPin, const bool &pulledUp = true, const bool &typeNO = true, const unsigned long int &dbncTimeOrigSett = 0, const unsigned long int &strtDelay = 0);
+	/**
+	 * @brief Class virtual destructor
+	 */
+	virtual ~RtryEncdrMPBttn();
+	/**
+	 * @brief Samples and decodes the encoder channels, for the EXTI sampling mode.
+	 *
+	 * The method must be invoked from the HAL_GPIO_EXTI_Callback() function when the pin that generated the interrupt is one of the encoder channels pins. The otptCurVal changes are notified in the next object update.
+	 *
+	 * @param curTm Current time in milliseconds, as kept by the application (i.e. HAL_GetTick()), used for the velocity calculation.
+	 */
+	void encdrIsr(const unsigned long int &curTm);
+	/**
+	 * @brief Returns the accumulated detents count.
+	 *
+	 * The count is incremented for each forward detent and decremented for each backward detent, independently of the otptCurVal range limits.
+	 *
+	 * @return The detents count.
+	 */
+	const int32_t getDtntsCnt() const;
+	/**
+	 * @brief Returns the number of invalid channels transitions found.
+	 *
+	 * Invalid transitions -both channels changing between two samples- are produced by a too slow sampling or by electrical noise.
+	 *
+	 * @return The number of invalid transitions.
+	 */
+	const uint32_t getEncdrErrsCnt() const;
+	/**
+	 * @brief Returns the value of the EXTI sampling mode attribute flag.
+	 *
+	 * @retval true: The channels are sampled by external interrupts.
+	 * @retval false: The channels are sampled in every object update.
+	 */
+	const bool getEncdrExti() const;
+	/**
+	 * @brief Returns the otptCurVal attribute value.
+	 *
+	 * @return The current value.
+	 */
+	const uint16_t getOtptCurVal() const;
+	/**
+	 * @brief Returns the otptCurVal change for each detent.
+	 *
+	 * @return The step size.
+	 */
+	const uint16_t getOtptStpSize() const;
+	/**
+	 * @brief Returns the maximum otptCurVal value.
+	 *
+	 * @return The maximum value.
+	 */
+	const uint16_t getOtptValMax() const;
+	/**
+	 * @brief Returns the minimum otptCurVal value.
+	 *
+	 * @return The minimum value.
+	 */
+	const uint16_t getOtptValMin() const;
+	/**
+	 * @brief Returns the value of the wrap around attribute flag.
+	 *
+	 * @retval true: otptCurVal wraps around when a range limit is exceeded.
+	 * @retval false: otptCurVal saturates at the range limits.
+	 */
+	const bool getOtptWrp() const;
+	/**
+	 * @brief Returns the number of quarter steps per detent.
+	 *
+	 * @return The quarter steps per detent.
+	 */
+	const uint8_t getStpsPerDtnt() const;
+	/**
+	 * @brief Returns the encoder velocity.
+	 *
+	 * @return The velocity in detents per second, positive for forward rotation, negative for backward rotation, 0 if no detent was produced in the last _RtryEncdrVlctyTmOut milliseconds.
+	 */
+	const int32_t getVlcty() const;
+	/**
+	 * @brief Sets the channels sampling mode.
+	 *
+	 * Entering the EXTI mode configures the channels pins to generate external interrupts on both edges, the corresponding EXTI lines interrupts must be enabled in the NVIC by the application. Leaving the EXTI mode configures the pins back as inputs.
+	 *
+	 * @param newEncdrExti If true the channels are sampled by external interrupts, if false -the default value- they are sampled in every object update.
+	 */
+	void setEncdrExti(const bool &newEncdrExti);
+	/**
+	 * @brief Sets the otptCurVal attribute value.
+	 *
+	 * @param newVal The new value, must be in the [otptValMin, otptValMax] range.
+	 *
+	 * @retval true: The value was set.
+	 * @retval false: The value is out of range, the value was not changed.
+	 */
+	bool setOtptCurVal(const uint16_t &newVal);
+	/**
+	 * @brief Sets the otptCurVal change for each detent.
+	 *
+	 * @param newVal The step size, must be greater than 0.
+	 *
+	 * @retval true: The step size was set.
+	 * @retval false: The value was 0, the step size was not changed.
+	 */
+	bool setOtptStpSize(const uint16_t &newVal);
+	/**
+	 * @brief Sets the maximum otptCurVal value.
+	 *
+	 * If the current value is greater than the new maximum it's set to the new maximum.
+	 *
+	 * @param newVal The new maximum value, must be greater than otptValMin.
+	 *
+	 * @retval true: The value was set.
+	 * @retval false: The value is not greater than otptValMin, the value was not changed.
+	 */
+	bool setOtptValMax(const uint16_t &newVal);
+	/**
+	 * @brief Sets the minimum otptCurVal value.
+	 *
+	 * If the current value is less than the new minimum it's set to the new minimum.
+	 *
+	 * @param newVal The new minimum value, must be less than otptValMax.
+	 *
+	 * @retval true: The value was set.
+	 * @retval false: The value is not less than otptValMax, the value was not changed.
+	 */
+	bool setOtptValMin(const uint16_t &newVal);
+	/**
+	 * @brief Sets the wrap around attribute flag.
+	 *
+	 * @param newOtptWrp If true otptCurVal wraps around when a range limit is exceeded (i.e. for menu selections), if false -the default value- it saturates at the range limits.
+	 */
+	void setOtptWrp(const bool &newOtptWrp);
+	/**
+	 * @brief Sets the number of quarter steps per detent.
+	 *
+	 * @param newStpsPerDtnt The quarter steps per detent: 4 -the default value- for encoders completing a channels cycle per detent, 2 for encoders completing half a cycle per detent, 1 to count every transition.
+	 *
+	 * @retval true: The value was set.
+	 * @retval false: The value is not 1, 2 or 4, the value was not changed.
+	 */
+	bool setStpsPerDtnt(const uint8_t &newStpsPerDtnt);
+};
+
+//==========================================================>>
+
+/**
+ * @brief Models a Debounced Pulse Counter (**DPC**), for dry contact pulse generators as flow meters, energy meters and reed switch counters.
+ *
+ * The input signal pulses are counted by a dedicated debouncing mechanism, independent of the DbncdMPBttn debouncing process: a level change is accepted when the new level was kept for at least the **minimum pulse width** -in microseconds-, and each accepted change to the active level counts a pulse. The input might be sampled:
+ * - **Polled**: in every object update, with the object update time as time reference. Polling the object from a hardware timer ISR (see MpbHalTmrPollSrc) at a period several times shorter than the minimum pulse width lets pulse rates of hundreds of Hz be counted.
+ * - **ISR**: by the smplIsr(const uint32_t &) method, invoked from a hardware timer ISR at the needed sampling rate, or from the EXTI interrupt of the input pin on both edges, with a microseconds time reference. In the EXTI case each level is validated when the next edge arrives.
+ *
+ * The counter keeps a 32 bits pulses count and a **rate estimate**, calculated at the end of each rate period from the pulses counted in that period. To avoid a notification per pulse the outputs change is signaled only at the end of a rate period in which pulses were counted or the rate changed, and -optionally- each time the count reaches a multiple of a notification step. The isOn attribute flag is set while pulses are being received (the last rate estimate is not 0), and the low 16 bits of the count are included in the packed outputs word as otptCurVal.
+ *
+ * @class PlsCntrMPBttn
+ */
+class PlsCntrMPBttn: public DbncdMPBttn{
+protected:
+	volatile uint32_t _plsCnt{0};
+	bool _plsIsrSmpl{false};
+	uint32_t _plsMinWdth{1000};
+	uint32_t _plsNtfNxtCnt{0};
+	uint32_t _plsNtfStp{0};
+	bool _plsRawLvl{false};
+	uint32_t _plsRawTm{0};
+	uint32_t _plsRt{0};
+	unsigned long int _plsRtPrd{1000};
+	uint32_t _plsRtPrdStrtCnt{0};
+	unsigned long int _plsRtPrdStrtTm{0};
+	bool _plsStblLvl{false};
+
+	uint32_t _otptsSttsPkg(uint32_t prevVal = 0);
+	void _smplPls(const uint32_t &curTmUs);
+	virtual bool updIsPressed();
+public:
+	/**
+	 * @brief Class constructor
+	 *
+	 * @note For the parameters see DbncdMPBttn(GPIO_TypeDef*, const uint16_t, const bool, const bool, const unsigned long int), the debounce time applies to the isOn flag changes, not to the pulses counting.
+	 */
+	PlsCntrMPBttn(GPIO_TypeDef* mpbttnPort, const uint16_t &mpbttnPin, const bool &pulledUp = true, const bool &typeNO = true, const unsigned long int &dbncTimeOrigSett = 0);
+	/**
+	 * @brief Class constructor
+	 *
+	 * @note For the parameters see DbncdMPBttn(gpioPinId_t, const bool, const bool, const unsigned long int)
+	 */
+	PlsCntrMPBttn(gpioPinId_t mpbttnPinStrct, const bool &pulledUp = true, const bool &typeNO = true, const unsigned long int &dbncTimeOrigSett = 0);
+	/**
+	 * @brief Class virtual destructor
+	 */
+	virtual ~PlsCntrMPBttn();
+	/**
+	 * @brief Returns the pulses count.
+	 *
+	 * @return The number of pulses counted since instantiation or since the last rstPlsCnt() invocation, wrapping around at 2^32.
+	 */
+	const uint32_t getPlsCnt() const;
+	/**
+	 * @brief Returns the value of the ISR sampling attribute flag.
+	 *
+	 * @retval true: The input is sampled by the smplIsr(const uint32_t &) method.
+	 * @retval false: The input is sampled in every object update.
+	 */
+	const bool getPlsIsrSmpl() const;
+	/**
+	 * @brief Returns the minimum pulse width.
+	 *
+	 * @return The minimum pulse width in microseconds.
+	 */
+	const uint32_t getPlsMinWdth() const;
+	/**
+	 * @brief Returns the notification step.
+	 *
+	 * @return The notification step, 0 if the count notifications are disabled.
+	 */
+	const uint32_t getPlsNtfStp() const;
+	/**
+	 * @brief Returns the pulses rate estimate, calculated at the end of the last completed rate period.
+	 *
+	 * @return The rate, in pulses per 1000 seconds (milliHertz).
+	 */
+	const uint32_t getPlsRt() const;
+	/**
+	 * @brief Returns the rate period.
+	 *
+	 * @return The rate period in milliseconds.
+	 */
+	const unsigned long int getPlsRtPrd() const;
+	/**
+	 * @brief Resets the pulses count to 0.
+	 *
+	 * The rate period in progress is restarted.
+	 */
+	void rstPlsCnt();
+	/**
+	 * @brief Sets the ISR sampling attribute flag.
+	 *
+	 * @param newPlsIsrSmpl If true the input is sampled only by the smplIsr(const uint32_t &) method, if false -the default value- the input is sampled in every object update.
+	 */
+	void setPlsIsrSmpl(const bool &newPlsIsrSmpl);
+	/**
+	 * @brief Sets the minimum pulse width.
+	 *
+	 * Both the active and the inactive levels must be kept for at least this time to be accepted, so the maximum rate counted is 1 / (2 * minimum width). Default value is 1000 microseconds.
+	 *
+	 * @param newVal The minimum pulse width in microseconds.
+	 */
+	void setPlsMinWdth(const uint32_t &newVal);
+	/**
+	 * @brief Sets the notification step.
+	 *
+	 * When set, the outputs change is also signaled each time the count reaches a multiple of the step.
+	 *
+	 * @param newVal The notification step in pulses, 0 -the default value- disables the count notifications.
+	 */
+	void setPlsNtfStp(const uint32_t &newVal);
+	/**
+	 * @brief Sets the rate period.
+	 *
+	 * Longer periods give better resolution rate estimates for low pulse rates, and less frequent notifications. Default value is 1000 milliseconds.
+	 *
+	 * @param newVal The rate period in milliseconds.
+	 *
+	 * @retval true: The value was set.
+	 * @retval false: The value was 0, the period was not changed.
+	 */
+	bool setPlsRtPrd(const unsigned long int &newVal);
+	/**
+	 * @brief Samples the input, for the ISR sampling mode.
+	 *
+	 * @param curTmUs Current time in microseconds, i.e. a free running hardware timer counter value at 1 MHz.
+	 */
+	void smplIsr(const uint32_t &curTmUs);
+};
+
+//==========================================================>>
+
+/**
+ * @brief Models a multi-position Selector Switch (**SS**), a rotary or slide switch wired with one pin per position, as a single object.
+ *
+ * All the positions pins are sampled in the same poll from snapshots of their ports -one input data register access per port-, building a **position code** (one bit per position). The code is debounced as a single value: a new code is accepted when it's kept unchanged for the debounce time. The accepted codes are validated:
+ * - **One position active**: the code is a valid position, that becomes the current position.
+ * - **No position active**: the contacts of a break-before-make switch are between positions, the current position is kept. If the situation lasts more than the break time out the switch is considered faulty (broken wire or contact).
+ * - **Several positions active**: the code is invalid (make-before-break switch, short circuit or wrong wiring), the switch is considered faulty and the invalid code is counted.
+ *
+ * The current position is provided as the otptCurVal value in the packed outputs word, so a position change produces a single outputs change notification. The isOn attribute flag is set while the switch is in a valid position, so any fault is signaled by the isOn flag reset.
+ *
+ * @class SlctrSwtchMPBttn
+ */
+class SlctrSwtchMPBttn: public DbncdMPBttn{
+protected:
+	unsigned long int _brkTmOut{_SlctrSwtchStdBrkTmOut};
+	uint16_t _cndtCode{0};
+	unsigned long int _cndtTm{0};
+	uint8_t _curPstn{0xFF};
+	uint32_t _invldCodesCnt{0};
+	uint8_t _pstnsCnt{0};
+	gpioPinId_t _pstnsPins[_SlctrSwtchMaxPstns]{};
+	uint8_t _pstnsPortIdx[_SlctrSwtchMaxPstns]{};
+	GPIO_TypeDef* _pstnsPorts[_SlctrSwtchMaxPstns]{};
+	uint8_t _pstnsPortsCnt{0};
+	bool _slctrFlt{false};
+	uint16_t _stblCode{0};
+
+	uint32_t _otptsSttsPkg(uint32_t prevVal = 0);
+	uint16_t _rdPstnCode();
+	virtual bool updIsPressed();
+public:
+	/**
+	 * @brief Class constructor
+	 *
+	 * The positions pins are configured as inputs with the internal pull-up or pull-down resistors.
+	 *
+	 * @param pstnsPins Array of the positions pins, the position number of each pin being it's index in the array.
+	 * @param pstnsCnt Number of positions, up to _SlctrSwtchMaxPstns. Invalid values build an object with no positions, always in faulty state.
+	 * @param pulledUp (Optional) If true -the default value- the pins are pulled up and a position is active when it's pin is at low level, if false the pins are pulled down and a position is active when it's pin is at high level.
+	 * @param dbncTimeOrigSett (Optional) Debounce time for the position code, see DbncdMPBttn(GPIO_TypeDef*, const uint16_t, const bool, const bool, const unsigned long int).
+	 */
+	SlctrSwtchMPBttn(gpioPinId_t* pstnsPins, const uint8_t &pstnsCnt, const bool &pulledUp = true, const unsigned long int &dbncTimeOrigSett = 0);
+	/**
+	 * @brief Class virtual destructor
+	 */
+	virtual ~SlctrSwtchMPBttn();
+	/**
+	 * @brief Returns the break time out.
+	 *
+	 * @return The time, in milliseconds, the switch might show no active position before being considered faulty.
+	 */
+	const unsigned long int getBrkTmOut() const;
+	/**
+	 * @brief Returns the current position.
+	 *
+	 * @return The current position number.
+	 * @retval 0xFF: No valid position was found since instantiation.
+	 */
+	const uint8_t getCurPstn() const;
+	/**
+	 * @brief Returns the number of invalid position codes -several positions active- accepted.
+	 *
+	 * @return The number of invalid codes.
+	 */
+	const uint32_t getInvldCodesCnt() const;
+	/**
+	 * @brief Returns the number of positions of the switch.
+	 *
+	 * @return The number of positions.
+	 */
+	const uint8_t getPstnsCnt() const;
+	/**
+	 * @brief Returns the fault condition of the switch.
+	 *
+	 * @retval true: The switch shows several positions active, or no position active for longer than the break time out.
+	 * @retval false: The switch is in a valid position, or between positions.
+	 */
+	const bool getSlctrFlt() const;
+	/**
+	 * @brief Returns the last accepted (debounced) position code.
+	 *
+	 * @return The position code, one bit per position, the position number being the bit position.
+	 */
+	const uint16_t getStblCode() const;
+	/**
+	 * @brief Sets the break time out.
+	 *
+	 * @param newVal The time, in milliseconds, the switch might show no active position before being considered faulty. Default value is _SlctrSwtchStdBrkTmOut.
+	 */
+	void setBrkTmOut(const unsigned long int &newVal);
+};
+
+//==========================================================>>
+
+/**
+ * @brief Models a **Two-Hand Control** (**THC**), the safety control of presses and other dangerous machines, built out of two push buttons that must be operated simultaneously.
+ *
+ * Both buttons -the **channels**- are sampled in the same poll, from a single input data register read when both are in the same port, and each one is debounced independently keeping the time stamp of the start of it's press. The control behavior is:
+ * - The output (isOn) is set only if both channels are pressed, and their press time stamps are within the **simultaneity window** (by default _TwoHndStdSmltntyWndw milliseconds).
+ * - If the window expires with only one channel pressed, or the second press comes too late, the cycle is **blocked**, and the simultaneity failures counter is incremented.
+ * - The output is reset as soon as either channel is released.
+ * - After the output was set, or after a blocked cycle, both channels must be released before a new cycle might be started.
+ * - The control starts in the blocked state: both channels must be read released, for their debounce time, before the first cycle might be started, so channels held, bridged or stuck at power-up never set the output.
+ *
+ * The control state is provided as the otptCurVal value in the packed outputs word (see twoHndStts), any state change being notified, so the application might signal the waiting and blocked states to the operator. The simultaneity failures, the completed cycles count and the time difference between the presses of the last cycle are provided as diagnostics.
+ *
+ * The channels might be bound to an input source instead of GPIO pins (see setChnlsInptSrc(MpbInptSrc*, const uint16_t &, const uint16_t &)), as a software input source for host simulation.
+ *
+ * @class TwoHndMPBttn
+ */
+class TwoHndMPBttn: public DbncdMPBttn{
+public:
+	/**
+	 * @brief Two-hand control states, as provided in the otptCurVal value.
+	 */
+	enum twoHndStts {
+		thArmd = 0,	/**< Both channels released, ready for a new cycle */
+		thWtng,	/**< One channel pressed, waiting for the other inside the simultaneity window */
+		thOn,	/**< Both channels pressed inside the simultaneity window, the output is set */
+		thBlckd	/**< Cycle ended or failed, waiting for both channels to be released */
+	};
+protected:
+	bool _chnlRaw[2]{true, true};	//The channels are taken as pressed until a debounced release is read
+	unsigned long int _chnlRawTm[2]{};
+	gpioPinId_t _chnlsPins[2]{};
+	uint16_t _chnlsInptIdx[2]{};
+	MpbInptSrc* _chnlsInptSrc{nullptr};
+	bool _chnlStbl[2]{true, true};
+	unsigned long int _chnlPrssTm[2]{};
+	uint32_t _cyclsCnt{0};
+	unsigned long int _lstPrssDlt{0};
+	uint32_t _smltntyFlsCnt{0};
+	unsigned long int _smltntyWndw{_TwoHndStdSmltntyWndw};
+	twoHndStts _twoHndStt{thBlckd};
+
+	uint32_t _otptsSttsPkg(uint32_t prevVal = 0);
+	void _rdChnls(bool* chnlsSt);
+	void _setTwoHndStt(const twoHndStts &newStt);
+	virtual bool updIsPressed();
+	virtual bool updValidPressesStatus();
+public:
+	/**
+	 * @brief Class constructor
+	 *
+	 * The channels pins are configured as inputs with the internal pull-up or pull-down resistors, their GPIO ports clocks are enabled.
+	 *
+	 * @param lftPin Left hand button pin.
+	 * @param rghtPin Right hand button pin.
+	 * @param pulledUp (Optional) Indicates if the buttons inputs are pulled up, see DbncdMPBttn(GPIO_TypeDef*, const uint16_t, const bool, const bool, const unsigned long int).
+	 * @param typeNO (Optional) Indicates if the buttons are Normally Open, see DbncdMPBttn(GPIO_TypeDef*, const uint16_t, const bool, const bool, const unsigned long int).
+	 * @param dbncTimeOrigSett (Optional) Debounce time applied to each channel, see DbncdMPBttn(GPIO_TypeDef*, const uint16_t, const bool, const bool, const unsigned long int).
+	 */
+	TwoHndMPBttn(gpioPinId_t lftPin, gpioPinId_t rghtPin, const bool &pulledUp = true, const bool &typeNO = true, const unsigned long int &dbncTimeOrigSett = 0);
+	/**
+	 * @brief Class virtual destructor
+	 */
+	virtual ~TwoHndMPBttn();
+	/**
+	 * @brief Returns the debounced state of a channel.
+	 *
+	 * The channels are taken as pressed until their first debounced release is read.
+	 *
+	 * @param chnlIdx Channel index, 0 for the left hand button, 1 for the right hand button.
+	 *
+	 * @retval true: The channel is pressed.
+	 * @retval false: The channel is released, or the index is out of range.
+	 */
+	const bool getChnlSt(const uint8_t &chnlIdx) const;
+	/**
+	 * @brief Returns the number of completed cycles, the times the output was set.
+	 *
+	 * @return The number of cycles.
+	 */
+	const uint32_t getCyclsCnt() const;
+	/**
+	 * @brief Returns the time difference between the presses of both channels in the last cycle that had both channels pressed.
+	 *
+	 * @return The time difference, in milliseconds.
+	 */
+	const unsigned long int getLstPrssDlt() const;
+	/**
+	 * @brief Returns the number of simultaneity failures, the cycles blocked for the second channel not being pressed inside the simultaneity window.
+	 *
+	 * @return The number of failures.
+	 */
+	const uint32_t getSmltntyFlsCnt() const;
+	/**
+	 * @brief Returns the simultaneity window.
+	 *
+	 * @return The maximum time, in milliseconds, between the presses of both channels.
+	 */
+	const unsigned long int getSmltntyWndw() const;
+	/**
+	 * @brief Returns the two-hand control state.
+	 *
+	 * @return The current state, see twoHndStts.
+	 */
+	const twoHndStts getTwoHndStt() const;
+	/**
+	 * @brief Binds the channels to the inputs of an input source, instead of the GPIO pins.
+	 *
+	 * @param newInptSrc Pointer to the input source, nullptr to revert to the GPIO pins.
+	 * @param lftIdx Index of the left hand button input in the source.
+	 * @param rghtIdx Index of the right hand button input in the source.
+	 *
+	 * @retval true: The source was set.
+	 * @retval false: An index is out of the source range, no change was made.
+	 */
+	bool setChnlsInptSrc(MpbInptSrc* newInptSrc, const uint16_t &lftIdx, const uint16_t &rghtIdx);
+	/**
+	 * @brief Sets the simultaneity window.
+	 *
+	 * @param newVal The maximum time, in milliseconds, between the presses of both channels. Default value is _TwoHndStdSmltntyWndw.
+	 */
+	void setSmltntyWndw(const unsigned long int &newVal);
+};
+
+//==========================================================>>
+
+/**
+ * @brief Models a group of DbncdMPBttn class and subclasses objects, to be managed as a set.
+ *
+ * A group keeps a list of registered MPB objects -up to _MpbGrpMaxSize- that might be of any of the DbncdMPBttn subclasses, mixed as needed. The registered objects keep their independent behavior, the group provides services that apply to all of them as a single unit.
+ *
+ * The main service provided is the **snapshot**: the packed output words (see DbncdMPBttn::getOtptsSttsPkgd()) of all the registered objects are read in one single operation, executed as a critical section. As every object's state update is executed as a critical section too, the snapshot is taken at a poll boundary: no object can be updated while the snapshot is being taken, and every object's values are read in a stable state. The result is a coherent input image of all the objects, that relieves the consumer of calling each object's getters separately, with no guarantee of consistency between them.
+ *
+ * The group also provides **output bindings**: any attribute flag of the registered objects' packed output words might be bound to a GPIO output pin, and after each update cycle the bound pins are written to reflect the flags values, with a single atomic BSRR register write for all the bound pins of each port. This provides zero callback, minimum latency paths from the inputs to the outputs they control (relays, LEDs).
+ *
+ * @warning The group keeps pointers to the registered objects, the objects must be removed from the group before being destroyed.
+ *
+ * @class MpbGrp
+ */
+class MpbGrp{
+protected:
+	struct MpbOtptBndng_t{
+		DbncdMPBttn* mpb;
+		uint8_t otptBitPos;
+		GPIO_TypeDef* port;
+		uint16_t pin;
+		bool actvHigh;
+	};
+
+	bool _dpndncsCycl{false};
+	uint8_t _evalOrdr[_MpbGrpMaxSize]{};
+	bool _evalOrdrVld{true};
+	uint32_t _evalOrdrSbscrptnsVer{0};
+	MpbInptSrc* _inptSrcsArr[_MpbGrpMaxInptSrcs]{};
+	uint8_t _inptSrcsCnt{0};
+	DbncdMPBttn* _mpbsArr[_MpbGrpMaxSize]{};
+	uint8_t _mpbsCnt{0};
+	MpbOtptBndng_t _otptBndngsArr[_MpbGrpMaxOtptBndngs]{};
+	uint8_t _otptBndngsCnt{0};
+
+	void _sortEvalOrdr();
+	void _updMpbs(const unsigned long int &curTm, const bool &dfrNtf = false);
+public:
+	/**
+	 * @brief Default class constructor
+	 *
+	 * Instantiates an empty group.
+	 */
+	MpbGrp();
+	/**
+	 * @brief Default virtual destructor
+	 *
+	 * @note Destroying the group does not affect the registered objects.
+	 */
+	virtual ~MpbGrp();
+	/**
+	 * @brief Registers an input source in the group.
+	 *
+	 * The registered sources are refreshed -see MpbInptSrc::scan(const unsigned long int &)- in the registration order at the start of every update cycle executed by updateAll(const unsigned long int &), before any object is updated.
+	 *
+	 * @param newInptSrc Pointer to the input source to register.
+	 *
+	 * @retval true: The source was registered.
+	 * @retval false: The source was not registered, the pointer was nullptr, the source was already registered or the maximum number of sources was reached.
+	 */
+	bool addInptSrc(MpbInptSrc* newInptSrc);
+	/**
+	 * @brief Registers a MPB object in the group.
+	 *
+	 * The objects are kept in the group in the same order they are registered, and that order is kept for every operation executed on the group, including the order of the output words in the snapshots.
+	 *
+	 * @param newMpb Pointer to the DbncdMPBttn class or subclass object to register.
+	 *
+	 * @retval true: The object was registered.
+	 * @retval false: The object was not registered, the pointer was nullptr, the object was already registered or the group was full.
+	 */
+	bool addMpb(DbncdMPBttn* newMpb);
+	/**
+	 * @brief Binds an attribute flag of a registered object to a GPIO output pin.
+	 *
+	 * After every update cycle executed by updateAll(const unsigned long int &) -or when wrtOtpts() is invoked- the pin is written to reflect the flag value.
+	 *
+	 * @param mpb Pointer to the registered object.
+	 * @param otptBitPos Position of the attribute flag in the object's packed output word: **IsOnBitPos**, **PilotOnBitPos**, **WrnngOnBitPos**, **IsVoidedBitPos**, **IsOnScndryBitPos** or any other of the single bit attribute flags.
+	 * @param otptPin The GPIO output pin. The pin is configured as a push-pull output, the GPIO port clock must be already enabled -as done by the CubeMX generated initialization code-.
+	 * @param actvHigh (Optional) If true -the default value- the pin is set to high level when the flag is set, if false the pin is set to low level when the flag is set.
+	 *
+	 * @retval true: The binding was set.
+	 * @retval false: The binding was not set, the object is not registered, the bit position is not valid, the pin is already bound or the maximum number of bindings was reached.
+	 */
+	bool bindOtpt(DbncdMPBttn* mpb, const uint8_t &otptBitPos, gpioPinId_t otptPin, const bool &actvHigh = true);
+	/**
+	 * @brief Returns a pointer to a registered MPB object
+	 *
+	 * @param mpbIdx Index of the object in the group.
+	 *
+	 * @return The pointer to the object.
+	 * @retval nullptr: There's no object registered with that index.
+	 */
+	DbncdMPBttn* getMpb(const uint8_t &mpbIdx);
+	/**
+	 * @brief Returns the value of the dependencies cycle flag.
+	 *
+	 * The flag is set when the subscriptions between the registered objects build a cycle, so that no evaluation order exists that places every publisher before it's subscribers. The objects involved in the cycle are then evaluated in the registration order.
+	 *
+	 * @retval true: A dependencies cycle was found when calculating the evaluation order.
+	 * @retval false: No dependencies cycle was found.
+	 */
+	const bool getDpndncsCycl();
+	/**
+	 * @brief Returns the number of input sources registered in the group
+	 *
+	 * @return The number of registered input sources.
+	 */
+	const uint8_t getInptSrcsCnt() const;
+	/**
+	 * @brief Returns a pointer to a registered MPB object by it's position in the group evaluation order.
+	 *
+	 * The evaluation order is the order in which the objects are updated by updateAll(const unsigned long int &). See that method for details.
+	 *
+	 * @param evalPos Position in the evaluation order.
+	 *
+	 * @return The pointer to the object.
+	 * @retval nullptr: There's no object in that position.
+	 */
+	DbncdMPBttn* getEvalMpb(const uint8_t &evalPos);
+	/**
+	 * @brief Returns the number of MPB objects registered in the group
+	 *
+	 * @return The number of registered objects.
+	 */
+	const uint8_t getMpbsCnt() const;
+	/**
+	 * @brief Returns the number of output bindings set
+	 *
+	 * @return The number of output bindings.
+	 */
+	const uint8_t getOtptBndngsCnt() const;
+	/**
+	 * @brief Returns the index of a registered MPB object in the group.
+	 *
+	 * The index is the position of the object's output word in the snapshots, and the position of its isOn flag in the isOn bitmap.
+	 *
+	 * @param mpb Pointer to the object to look for.
+	 *
+	 * @return The index of the object in the group.
+	 * @retval 0xFF: The object is not registered in the group.
+	 */
+	uint8_t getMpbIdx(DbncdMPBttn* mpb);
+	/**
+	 * @brief Takes a snapshot of the packed output words of all the registered objects.
+	 *
+	 * The snapshot is taken as a single critical section, ensuring no object is updated while it's taken. See the class description for details.
+	 *
+	 * @param otptsPkgsArr Pointer to an array of uint32_t to receive the packed output words, in the objects registration order. For the packed output words encoding see DbncdMPBttn::getOtptsSttsPkgd(), the words might be decoded using otptsSttsUnpkg(uint32_t).
+	 * @param arrSize Number of elements of the otptsPkgsArr array, if the number of registered objects is greater than arrSize only the first arrSize objects will be included in the snapshot.
+	 * @param isOnBtmp (Optional) Pointer to an array of uint32_t to receive a bitmap of the isOn attribute flags of the objects included in the snapshot, one bit per object in the registration order (object i is bit (i % 32) of element (i / 32)). The array must hold at least ((arrSize + 31) / 32) elements. If nullptr is passed -the default value- no bitmap is built.
+	 *
+	 * @return The number of objects included in the snapshot.
+	 */
+	uint8_t getSnpsht(uint32_t* otptsPkgsArr, const uint8_t &arrSize, uint32_t* isOnBtmp = nullptr);
+	/**
+	 * @brief Removes a registered input source from the group.
+	 *
+	 * @param inptSrc Pointer to the input source to remove.
+	 *
+	 * @retval true: The source was removed.
+	 * @retval false: The source was not registered in the group.
+	 *
+	 * @note The objects bound to the source inputs are not unbound, their inputs will keep the last state read until the source is refreshed by other means.
+	 */
+	bool rmvInptSrc(MpbInptSrc* inptSrc);
+	/**
+	 * @brief Removes a registered MPB object from the group.
+	 *
+	 * The objects registered after the removed one will see their index in the group decreased by one. The output bindings of the removed object are removed.
+	 *
+	 * @param mpb Pointer to the object to remove.
+	 *
+	 * @retval true: The object was removed.
+	 * @retval false: The object was not registered in the group.
+	 */
+	virtual bool rmvMpb(DbncdMPBttn* mpb);
+	/**
+	 * @brief Refreshes the registered input sources, in the registration order.
+	 *
+	 * The method is invoked by updateAll(const unsigned long int &) before updating the objects, it's provided for the applications updating the objects by other means.
+	 *
+	 * @param curTm Current time in milliseconds, as kept by the application.
+	 */
+	void scanInptSrcs(const unsigned long int &curTm);
+	/**
+	 * @brief Removes the output binding of a GPIO pin.
+	 *
+	 * @param otptPin The bound GPIO output pin. The pin keeps it's last written level.
+	 *
+	 * @retval true: The binding was removed.
+	 * @retval false: The pin was not bound.
+	 */
+	bool unbindOtpt(gpioPinId_t otptPin);
+	/**
+	 * @brief Executes a complete update cycle for all the registered objects.
+	 *
+	 * The registered input sources are refreshed first, then each registered object is updated by its DbncdMPBttn::update(const unsigned long int &) method, all of them with the same time reference. The result is a deterministic scan of all the objects, that might be driven from the application's cyclic executive or main loop, and not needing any begin() timer.
+	 *
+	 * The objects are updated in the **evaluation order**: the registration order, modified so that every object is updated after the registered objects it's subscribed to (see DbncdMPBttn::addSbscrbr(DbncdMPBttn*)). This topological ordering of the dependencies lets chained objects react to their publishers' changes in the same update cycle. The evaluation order is recalculated automatically when objects are registered or removed, and when any subscription changes.
+	 *
+	 * After all the objects are updated the bound outputs are written (see wrtOtpts()).
+	 *
+	 * @param curTm Current time in milliseconds, as kept by the application.
+	 */
+	virtual void updateAll(const unsigned long int &curTm);
+	/**
+	 * @brief Writes the bound GPIO output pins to reflect their bound attribute flags values.
+	 *
+	 * The levels of all the bound pins of each port are written by a single BSRR register write, so all the pins of a port change simultaneously and atomically, without any read-modify-write of the port registers.
+	 */
+	void wrtOtpts();
+};
+
+//==========================================================>>
+
+/**
+ * @brief Models a **radio group**: a MpbGrp group in which a set of latching objects are mutually exclusive, latching one of them unlatches the others.
+ *
+ * The exclusivity is enforced inside the group's update cycle: after all the registered objects are updated, if a radio member entered the On state it becomes the new selection and every other radio member in On state is unlatched and turned off immediately, in a short critical section holding only the selection evaluation and the siblings resets. The switch-over is completed before any of the cycle results is delivered: the members outputs change notifications are deferred (see DbncdMPBttn::update(const unsigned long int &, const bool &)), and the bound outputs (see MpbGrp::bindOtpt(DbncdMPBttn*, const uint8_t &, gpioPinId_t, const bool &)) are written after the exclusivity step, so no notification and no bound output ever shows two members selected, and the new member On change and the siblings Off changes are delivered in the same cycle. The members are updated -inputs scanned, HAL calls executed- with the interrupts enabled. If several members are pressed in the same cycle the first one in radio registration order wins.
+ *
+ * @note A snapshot (see MpbGrp::getSnpsht(uint32_t*, const uint8_t &, uint32_t*)) taken by a task or ISR preempting the update cycle -between the members update and the exclusivity step- might see two members in On state. Snapshots taken from the updating context, or synchronized to the group notifications, always see a single selected member.
+ *
+ * Each selection change -including the selected member being toggled off, leaving the group with no selection- is signaled by a single group notification, carrying the index of the new selected member (0xFF for no selection), by the function set with setFnWhnSlctnChng(fncOtptsChngPtrType) and by the task set with setTaskToNotify(const TaskHandle_t).
+ *
+ * The radio members might be any LtchMPBttn subclass, being TgglLtchMPBttn the usual choice. The group might hold other objects not belonging to the radio set, registered with MpbGrp::addMpb(DbncdMPBttn*).
+ *
+ * @warning The radio members must be updated exclusively by the group, through updateAll(const unsigned long int &) -directly or by a MpbPollSrc polling source-, and not by their own begin() timers, as independent polling reintroduces the races the group is designed to avoid.
+ *
+ * @class MpbRdGrp
+ */
+class MpbRdGrp: public MpbGrp{
+protected:
+	fncOtptsChngPtrType _fnWhnSlctnChng{nullptr};
+	LtchMPBttn* _rdMpbsArr[_MpbRdGrpMaxSize]{};
+	uint8_t _rdMpbsCnt{0};
+	uint8_t _slctdIdx{0xFF};
+#ifndef MPB_BARE_METAL
+	TaskHandle_t _taskToNotifyHndl {NULL};
+#endif
+
+	void _notifySlctnChng();
+	bool _updSlctn();
+public:
+	/**
+	 * @brief Default class constructor
+	 */
+	MpbRdGrp();
+	/**
+	 * @brief Class virtual destructor
+	 */
+	virtual ~MpbRdGrp();
+	/**
+	 * @brief Registers a latching object as a member of the radio set.
+	 *
+	 * The object is registered in the group (see MpbGrp::addMpb(DbncdMPBttn*)) and added to the radio set. If the object is in On state when registered and the group has no selection, it becomes the selected member, otherwise it's unlatched.
+	 *
+	 * @param newMpb Pointer to the object to register.
+	 *
+	 * @retval true: The object was registered.
+	 * @retval false: The pointer is nullptr, the object was already registered, or the group or the radio set are full.
+	 */
+	bool addRdMpb(LtchMPBttn* newMpb);
+	/**
+	 * @brief Returns the function set to be executed when the selection changes.
+	 *
+	 * @return The function pointer, or nullptr if no function is set.
+	 */
+	fncOtptsChngPtrType getFnWhnSlctnChng();
+	/**
+	 * @brief Returns the number of radio members.
+	 *
+	 * @return The number of radio members.
+	 */
+	const uint8_t getRdMpbsCnt() const;
+	/**
+	 * @brief Returns a pointer to a radio member.
+	 *
+	 * @param rdIdx Index of the member in the radio set, in registration order.
+	 *
+	 * @return The pointer to the member, or nullptr if the index is out of range.
+	 */
+	LtchMPBttn* getRdMpb(const uint8_t &rdIdx);
+	/**
+	 * @brief Returns the selected radio member.
+	 *
+	 * @return Pointer to the selected member, or nullptr if there's no selection.
+	 */
+	LtchMPBttn* getSlctd();
+	/**
+	 * @brief Returns the index of the selected radio member.
+	 *
+	 * @return The index of the selected member in the radio set.
+	 * @retval 0xFF: There's no selection.
+	 */
+	const uint8_t getSlctdIdx() const;
+#ifndef MPB_BARE_METAL
+	/**
+	 * @brief Returns the task to be notified when the selection changes.
+	 *
+	 * @return The TaskHandle_t of the task, or NULL if no task is set.
+	 */
+	const TaskHandle_t getTaskToNotify() const;
+#endif
+	/**
+	 * @brief see MpbGrp::rmvMpb(DbncdMPBttn*)
+	 *
+	 * If the object is a radio member it's removed from the radio set too. Removing the selected member leaves the group with no selection, without notification.
+	 */
+	virtual bool rmvMpb(DbncdMPBttn* mpb);
+	/**
+	 * @brief Sets the function to be executed when the selection changes.
+	 *
+	 * The function receives the index of the new selected member, or 0xFF if there's no selection. It's executed from the update cycle context, that might be an ISR context when polled by a MpbPollSrc source.
+	 *
+	 * @param newFnWhnSlctnChng Function pointer, nullptr to disable the mechanism.
+	 */
+	void setFnWhnSlctnChng(fncOtptsChngPtrType newFnWhnSlctnChng);
+#ifndef MPB_BARE_METAL
+	/**
+	 * @brief Sets the task to be notified when the selection changes.
+	 *
+	 * The task is notified with xTaskNotify() -xTaskNotifyFromISR() when polled from an ISR-, the notification value being the index of the new selected member, or 0xFF if there's no selection.
+	 *
+	 * @param newTaskHandle The TaskHandle_t of the task, NULL to disable the mechanism.
+	 */
+	void setTaskToNotify(const TaskHandle_t &newTaskHandle);
+#endif
+	/**
+	 * @brief see MpbGrp::updateAll(const unsigned long int &)
+	 *
+	 * The registered objects are updated as by MpbGrp, outside any group level critical section and with their outputs change notifications deferred, then the radio exclusivity is enforced in a critical section limited to the selection evaluation and the siblings resets. The bound outputs are written next, then the members pending notifications and the selection change notification are delivered.
+	 */
+	virtual void updateAll(const unsigned long int &curTm);
+};
+
+//==========================================================>>
+
+/**
+ * @brief Models a polling scheduler for MPB objects, organized in polling rate classes.
+ *
+ * The scheduler replaces the independent per object timers set by DbncdMPBttn::begin(const unsigned long int) with a single periodic base tick, that might be provided by the scheduler's own FreeRTOS timer (see begin()) or by the application invoking tick(const unsigned long int &) from SysTick, a hardware timer interrupt or a cyclic executive.
+ *
+ * Each object is registered with it's polling period, the objects sharing the same polling period build a **rate class** -up to _MpbSchdlrMaxClss classes-, each class polling period is a multiple of the base tick period. The scheduler guarantees:
+ * - **Phase staggered slots**: The objects of a class are distributed in as many slots as base ticks the class period includes, so that in each base tick only the objects of one slot of each class are polled, keeping the per tick polling load flat instead of polling all the class objects in the same tick.
+ * - **Priority**: The classes are kept ordered by their polling period, in each base tick the objects of the faster classes are polled before the objects of the slower classes.
+ * - **Dependencies**: The objects of a class linked by subscriptions -a publisher and it's chain of subscribers- are placed as a whole in the same slot, polled in the class evaluation order (see MpbGrp::updateAll(const unsigned long int &)), so that chained objects react in the same tick. The chains are distributed among the slots as single objects are, each one to the least loaded slot. Objects in different classes are not ordered: a subscriber in a faster class than it's publisher reacts to the publisher's change in it's next poll, not in the same tick.
+ *
+ * @class MpbSchdlr
+ */
+class MpbSchdlr{
+protected:
+	MpbGrp _clssGrps[_MpbSchdlrMaxClss]{};
+	uint16_t _clssPrdTcks[_MpbSchdlrMaxClss]{};
+	uint8_t _clssSltsCnt[_MpbSchdlrMaxClss]{};
+	uint8_t _clssSltsOrdr[_MpbSchdlrMaxClss][_MpbGrpMaxSize]{};
+	uint8_t _clssSltsStrt[_MpbSchdlrMaxClss][_MpbGrpMaxSize + 1]{};
+	uint8_t _clssCnt{0};
+#ifndef MPB_BARE_METAL
+	TimerHandle_t _schdlrTmrHndl{NULL};
+#endif
+	uint32_t _sltsSbscrptnsVer{0};
+	bool _sltsVld{false};
+	unsigned long int _tckMs{1};
+	uint32_t _tcksCnt{0};
+
+	void _bldSlts();
+#ifndef MPB_BARE_METAL
+	static void schdlrTmrCallback(TimerHandle_t schdlrTmrCbArg);
+#endif
+public:
+	/**
+	 * @brief Class constructor
+	 *
+	 * @param tckMs (Optional) The base tick period in milliseconds, the classes polling periods are rounded to a multiple of this value. Default value is 1 millisecond.
+	 */
+	MpbSchdlr(const unsigned long int &tckMs = 1);
+	/**
+	 * @brief Default virtual destructor
+	 */
+	virtual ~MpbSchdlr();
+	/**
+	 * @brief Registers an input source in the scheduler, in the rate class corresponding to the polling period.
+	 *
+	 * The source is refreshed once per class period, in the tick of the class first slot, before it's objects are updated. The objects of the later slots use that same image, so each source is scanned at the class polling rate whatever the number of slots. See MpbGrp::addInptSrc(MpbInptSrc*) for details.
+	 *
+	 * @param newInptSrc Pointer to the input source to register.
+	 * @param pollPrdMs The polling period of the class, rounded as done by addMpb(DbncdMPBttn*, const unsigned long int &). The objects bound to the source inputs must be registered in the same class.
+	 *
+	 * @retval true: The source was registered.
+	 * @retval false: The source was not registered, no rate class exists for the period or the source was rejected by the class group.
+	 */
+	bool addInptSrc(MpbInptSrc* newInptSrc, const unsigned long int &pollPrdMs);
+	/**
+	 * @brief Registers a MPB object in the scheduler, in the rate class corresponding to the polling period.
+	 *
+	 * If no rate class exists for the resulting period a new one is created, keeping the classes ordered by period.
+	 *
+	 * @param newMpb Pointer to the DbncdMPBttn class or subclass object to register.
+	 * @param pollPrdMs The object's polling period in milliseconds, rounded to the nearest multiple of the base tick period, with a minimum of one base tick.
+	 *
+	 * @retval true: The object was registered.
+	 * @retval false: The object was not registered, the pointer was nullptr, the object was already registered, the class was full or a new class was needed and the maximum number of classes was reached.
+	 *
+	 * @warning The objects registered in a scheduler must not be attached to their own polling timer by DbncdMPBttn::begin(const unsigned long int), nor updated by any other mechanism.
+	 */
+	bool addMpb(DbncdMPBttn* newMpb, const unsigned long int &pollPrdMs);
+	/**
+	 * @brief Binds an attribute flag of a registered object to a GPIO output pin.
+	 *
+	 * The binding is set in the rate class the object belongs to, and the pin is written after every tick in which the class objects are polled. See MpbGrp::bindOtpt(DbncdMPBttn*, const uint8_t &, gpioPinId_t, const bool &) for details.
+	 *
+	 * @retval true: The binding was set.
+	 * @retval false: The binding was not set, the object is not registered or the binding was rejected by the class group.
+	 */
+	bool bindOtpt(DbncdMPBttn* mpb, const uint8_t &otptBitPos, gpioPinId_t otptPin, const bool &actvHigh = true);
+#ifndef MPB_BARE_METAL
+	/**
+	 * @brief Attaches the scheduler to a FreeRTOS timer that executes the base tick.
+	 *
+	 * The timer period is the base tick period converted to RTOS ticks, with a minimum of one RTOS tick: a base tick period shorter than the RTOS tick period is executed at the RTOS tick rate. The time stamps passed to the objects are taken from the RTOS tick count, so their timing is kept, only the polling rate is reduced.
+	 *
+	 * @retval true: The scheduler could be attached to a timer.
+	 * @retval false: The scheduler could not create the needed timer, or it was already attached to one.
+	 */
+	bool begin();
+	/**
+	 * @brief Detaches the scheduler from it's FreeRTOS timer, deleting the timer.
+	 *
+	 * @retval true: The timer was stopped and deleted.
+	 * @retval false: The scheduler was not attached to a timer, or the timer could not be deleted.
+	 */
+	bool end();
+#endif
+	/**
+	 * @brief Returns the number of rate classes in use.
+	 *
+	 * @return The number of classes.
+	 */
+	const uint8_t getClssCnt() const;
+	/**
+	 * @brief Returns the polling period of a rate class.
+	 *
+	 * @param clssIdx Index of the class, 0 being the fastest class.
+	 *
+	 * @return The class polling period in milliseconds.
+	 * @retval 0: There's no class with that index.
+	 */
+	unsigned long int getClssPrd(const uint8_t &clssIdx);
+	/**
+	 * @brief Removes a registered MPB object from the scheduler.
+	 *
+	 * If the object was the last one of it's rate class, the class is removed.
+	 *
+	 * @param mpb Pointer to the object to remove.
+	 *
+	 * @retval true: The object was removed.
+	 * @retval false: The object was not registered in the scheduler.
+	 *
+	 * @note The slots of the objects of the class are recalculated, so one poll of those objects might be delayed or advanced by up to the class period.
+	 */
+	bool rmvMpb(DbncdMPBttn* mpb);
+	/**
+	 * @brief Executes a base tick of the scheduler.
+	 *
+	 * The objects of the current slot of each rate class are updated by their DbncdMPBttn::update(const unsigned long int &) method, fastest class first, each class input sources being refreshed once per class period -in the first slot tick, before it's objects update-, and it's bound outputs being written after the objects update.
+	 *
+	 * @param curTm Current time in milliseconds, as kept by the application.
+	 *
+	 * @note The method must be invoked once every base tick period, when not using the scheduler's own timer. It might be invoked from an ISR.
+	 */
+	void tick(const unsigned long int &curTm);
+};
+
+//==========================================================>>
+
+/**
+ * @brief Abstract class, models a periodic polling source for a MpbGrp group of MPB objects, driven by a periodic interrupt.
+ *
+ * The polling source is the alternative to the FreeRTOS software timers used by the DbncdMPBttn::begin(const unsigned long int) method, for applications needing a faster and more regular polling than the software timers tick granularity and timer daemon task scheduling provide. Each time the periodic interrupt is serviced the pollIsr() method must be invoked from the ISR, updating all the objects of the group with the MpbGrp::updateAll(const unsigned long int &) method, inside the ISR. The critical sections and task notifications executed by the objects detect the ISR context and use the ISR safe services.
+ *
+ * The time reference passed to the objects is kept by the source itself, adding the polling period on each poll, so it's independent of the system tick.
+ *
+ * For the jitter and latency evaluation of the polling mechanism the source keeps statistics of the time elapsed from the period start -the interrupt generating event- to the start of the poll (latency), and of the poll execution time, measured in counts of the free running counter provided by the subclass (for hardware timers the timer counter itself).
+ *
+ * @class MpbPollSrc
+ */
+class MpbPollSrc{
+protected:
+	unsigned long int _curTm{0};
+	uint32_t _exctnMax{0};
+	uint32_t _ltncyMax{0};
+	uint32_t _ltncyMin{0xFFFFFFFF};
+	MpbGrp* _mpbGrp{nullptr};
+	uint32_t _pollPrdUs{0};
+	uint32_t _pollsCnt{0};
+	uint32_t _tmRmndrUs{0};
+
+	virtual uint32_t _getCntrVal();
+public:
+	/**
+	 * @brief Class constructor
+	 *
+	 * @param mpbGrp Pointer to the MpbGrp object holding the MPB objects to be polled.
+	 * @param pollPrdUs The polling period in microseconds, must be the period of the interrupt invoking pollIsr().
+	 */
+	MpbPollSrc(MpbGrp* mpbGrp, const uint32_t &pollPrdUs);
+	/**
+	 * @brief Default virtual destructor
+	 */
+	virtual ~MpbPollSrc();
+	/**
+	 * @brief Starts the periodic interrupt source.
+	 *
+	 * @retval true: The source was started.
+	 * @retval false: The source could not be started.
+	 */
+	virtual bool begin() = 0;
+	/**
+	 * @brief Clears the jitter and latency statistics and the polls counter.
+	 */
+	void clrStats();
+	/**
+	 * @brief Stops the periodic interrupt source.
+	 *
+	 * @retval true: The source was stopped.
+	 * @retval false: The source could not be stopped.
+	 */
+	virtual bool end() = 0;
+	/**
+	 * @brief Returns the time reference kept by the source, and passed to the polled objects.
+	 *
+	 * @return The time in milliseconds.
+	 */
+	const unsigned long int getCurTm() const;
+	/**
+	 * @brief Returns the maximum poll execution time registered since the last clrStats() invocation.
+	 *
+	 * @return The maximum time, in counts of the source's counter.
+	 */
+	const uint32_t getExctnMax() const;
+	/**
+	 * @brief Returns the maximum latency registered since the last clrStats() invocation.
+	 *
+	 * The latency is the time elapsed from the period start to the start of the poll execution.
+	 *
+	 * @return The maximum latency, in counts of the source's counter.
+	 *
+	 * @note The polling jitter is the difference between the maximum and the minimum latencies.
+	 */
+	const uint32_t getLtncyMax() const;
+	/**
+	 * @brief Returns the minimum latency registered since the last clrStats() invocation.
+	 *
+	 * @return The minimum latency, in counts of the source's counter.
+	 */
+	const uint32_t getLtncyMin() const;
+	/**
+	 * @brief Returns the number of polls executed since the last clrStats() invocation.
+	 *
+	 * @return The number of polls.
+	 */
+	const uint32_t getPollsCnt() const;
+	/**
+	 * @brief Executes a poll of the group objects.
+	 *
+	 * The method must be invoked from the ISR servicing the periodic interrupt, once per period.
+	 */
+	void pollIsr();
+};
+
+//==========================================================>>
+
+#ifdef HAL_TIM_MODULE_ENABLED
+/**
+ * @brief Models a polling source driven by a STM32 hardware timer update interrupt, using the HAL TIM services.
+ *
+ * The timer must be configured by the application -i.e. by the CubeMX generated code- with the update event period equal to the polling period passed to the constructor, with the update interrupt enabled. Setting the timer prescaler to get a 1 MHz counter clock makes the latency and execution time statistics be expressed in microseconds.
+ *
+ * The pollIsr() method must be invoked from the HAL_TIM_PeriodElapsedCallback() function when the timer handle received as argument is the one returned by getTim().
+ *
+ * @class MpbHalTmrPollSrc
+ */
+class MpbHalTmrPollSrc: public MpbPollSrc{
+protected:
+	TIM_HandleTypeDef* _htim{nullptr};
+
+	virtual uint32_t _getCntrVal();
+public:
+	/**
+	 * @brief Class constructor
+	 *
+	 * @param mpbGrp Pointer to the MpbGrp object holding the MPB objects to be polled.
+	 * @param htim Pointer to the HAL handle of the already configured hardware timer.
+	 * @param pollPrdUs The timer update event period in microseconds.
+	 */
+	MpbHalTmrPollSrc(MpbGrp* mpbGrp, TIM_HandleTypeDef* htim, const uint32_t &pollPrdUs);
+	/**
+	 * @brief Class virtual destructor
+	 */
+	virtual ~MpbHalTmrPollSrc();
+	/**
+	 * @brief Starts the timer with it's update interrupt enabled.
+	 *
+	 * @retval true: The timer was started.
+	 * @retval false: The timer could not be started.
+	 */
+	virtual bool begin();
+	/**
+	 * @brief Stops the timer and it's update interrupt.
+	 *
+	 * @retval true: The timer was stopped.
+	 * @retval false: The timer could not be stopped.
+	 */
+	virtual bool end();
+	/**
+	 * @brief Returns the HAL handle of the hardware timer used as source.
+	 *
+	 * @return The pointer to the timer handle.
+	 */
+	TIM_HandleTypeDef* getTim();
+};
+#endif
+
+//==========================================================>>
+
+/**
+ * @brief Models a simulated polling source, a stand-in for the hardware timer source to be used for off-target (host) execution and testing.
+ *
+ * The simulated time is advanced by the run(const uint32_t &) method, executing as many polls as periods completed in the simulated time while the source is started. The poll latency might be set to a fixed value for the statistics mechanism testing.
+ *
+ * @class MpbHostPollSrc
+ */
+class MpbHostPollSrc: public MpbPollSrc{
+protected:
+	bool _isRunning{false};
+	uint32_t _simLtncy{0};
+	uint32_t _simRmndrUs{0};
+
+	virtual uint32_t _getCntrVal();
+public:
+	/**
+	 * @brief Class constructor
+	 *
+	 * @param mpbGrp Pointer to the MpbGrp object holding the MPB objects to be polled.
+	 * @param pollPrdUs The simulated polling period in microseconds.
+	 */
+	MpbHostPollSrc(MpbGrp* mpbGrp, const uint32_t &pollPrdUs);
+	/**
+	 * @brief Class virtual destructor
+	 */
+	virtual ~MpbHostPollSrc();
+	/**
+	 * @brief Starts the simulated source.
+	 *
+	 * @return true
+	 */
+	virtual bool begin();
+	/**
+	 * @brief Stops the simulated source.
+	 *
+	 * @return true
+	 */
+	virtual bool end();
+	/**
+	 * @brief Advances the simulated time, executing the polls corresponding to the periods completed.
+	 *
+	 * @param durationUs The simulated time to advance, in microseconds.
+	 */
+	void run(const uint32_t &durationUs);
+	/**
+	 * @brief Sets the simulated counter value read at the start of each poll, i.e. the simulated poll latency.
+	 *
+	 * @param newSimLtncy The simulated latency, in microseconds.
+	 */
+	void setSimLtncy(const uint32_t &newSimLtncy);
+};
+
+//==========================================================>>
+
+/**
+ * @brief Abstract class, models an input source: a set of digital inputs whose states are read in a single operation, to be used as MPB signals.
+ *
+ * The DbncdMPBttn class and subclasses objects read by default their own GPIO input pin. An input source replaces that pin read for the objects bound to one of it's inputs (see DbncdMPBttn::setInptSrc(MpbInptSrc*, const uint16_t &)), the source keeping an **image** of the state of all it's inputs, refreshed by the scan(const unsigned long int &) method once per polling cycle. Each bound object processes it's input state with it's own state machine, so every switch class behavior is available for the source inputs.
+ *
+ * The input states kept in the image are **active** states: true means the contact is closed or the signal asserted, independently of the electrical levels used by the source hardware.
+ *
+ * @class MpbInptSrc
+ */
+class MpbInptSrc{
+protected:
+	uint16_t _inptsCnt{0};
+	uint32_t _scnsCnt{0};
+public:
+	/**
+	 * @brief Class constructor
+	 *
+	 * @param inptsCnt Number of inputs provided by the source.
+	 */
+	MpbInptSrc(const uint16_t &inptsCnt);
+	/**
+	 * @brief Default virtual destructor
+	 */
+	virtual ~MpbInptSrc();
+	/**
+	 * @brief Returns the number of inputs provided by the source.
+	 *
+	 * @return The number of inputs, valid input indexes range from 0 to the number of inputs minus one.
+	 */
+	const uint16_t getInptsCnt() const;
+	/**
+	 * @brief Returns the state of an input, as kept in the source image.
+	 *
+	 * @param inptIdx Index of the input.
+	 *
+	 * @retval true: The input is active.
+	 * @retval false: The input is not active, or the index is not valid.
+	 */
+	virtual bool getInptSt(const uint16_t &inptIdx) = 0;
+	/**
+	 * @brief Returns the number of scans executed by the source.
+	 *
+	 * @return The number of scans.
+	 */
+	const uint32_t getScnsCnt() const;
+	/**
+	 * @brief Refreshes the source image, reading the state of all the inputs.
+	 *
+	 * @param curTm Current time in milliseconds, as kept by the application.
+	 */
+	virtual void scan(const unsigned long int &curTm) = 0;
+};
+
+//==========================================================>>
+
+/**
+ * @brief Models a key matrix (keypad) input source.
+ *
+ * The keys are placed at the crossings of the rows and columns lines, up to _MpbMtrxMaxLines rows and columns, and up to _MpbMtrxMaxKeys keys. The rows pins are configured as open drain outputs, the columns pins as pulled up inputs. Each scan drives every row to low level in turn, reading the columns pins: a low level column identifies a pressed key in the driven row. The columns pins are read by a single input data register access per port for each row, so the scan cost is proportional to the number of rows.
+ *
+ * The key index used to bind the objects is (row * columnsQty + column).
+ *
+ * **Ghosting**: in a matrix without diodes, three pressed keys at three corners of a rectangle connect the rows and columns of the fourth corner, making it's key read as pressed. The scan detects the situation -two rows sharing more than one pressed column- and keeps the previous state of the keys involved, as none of them can be read reliably, until the ambiguity disappears. The detection checks each pair of rows with a single AND operation. For matrices built with diodes the detection might be disabled.
+ *
+ * @class MpbMtrxInptSrc
+ */
+class MpbMtrxInptSrc: public MpbInptSrc{
+protected:
+	gpioPinId_t _colsPins[_MpbMtrxMaxLines]{};
+	uint8_t _colsCnt{0};
+	uint8_t _colsPortIdx[_MpbMtrxMaxLines]{};
+	GPIO_TypeDef* _colsPorts[_MpbMtrxMaxLines]{};
+	uint8_t _colsPortsCnt{0};
+	bool _ghstDtctn{true};
+	bool _ghstd{false};
+	uint32_t _ghstsCnt{0};
+	uint32_t _keysBtmp[(_MpbMtrxMaxKeys + 31) / 32]{};
+	gpioPinId_t _rowsPins[_MpbMtrxMaxLines]{};
+	uint8_t _rowsCnt{0};
+	uint8_t _sttlRds{_MpbMtrxStdSttlRds};
+public:
+	/**
+	 * @brief Class constructor
+	 *
+	 * The rows pins are configured as open drain outputs -left at high level- and the columns pins as pulled up inputs. The GPIO ports clocks must be already enabled.
+	 *
+	 * @param rowsPins Array of the rows pins.
+	 * @param rowsCnt Number of rows.
+	 * @param colsPins Array of the columns pins.
+	 * @param colsCnt Number of columns.
+	 *
+	 * @note If the number of rows or columns is 0 or greater than _MpbMtrxMaxLines, or the number of keys is greater than _MpbMtrxMaxKeys, the source is built with no inputs and no pin is configured.
+	 */
+	MpbMtrxInptSrc(gpioPinId_t* rowsPins, const uint8_t &rowsCnt, gpioPinId_t* colsPins, const uint8_t &colsCnt);
+	/**
+	 * @brief Class virtual destructor
+	 */
+	virtual ~MpbMtrxInptSrc();
+	/**
+	 * @brief Returns the number of columns of the matrix.
+	 *
+	 * @return The number of columns.
+	 */
+	const uint8_t getColsCnt() const;
+	/**
+	 * @brief Returns the value of the ghosting detection attribute flag.
+	 *
+	 * @retval true: Ghosting is detected and the ambiguous keys states are kept.
+	 * @retval false: Ghosting is not detected.
+	 */
+	const bool getGhstDtctn() const;
+	/**
+	 * @brief Returns the ghosting condition found in the last scan.
+	 *
+	 * @retval true: The last scan found ghosting, some keys states were kept from the previous scan.
+	 * @retval false: No ghosting was found in the last scan.
+	 */
+	const bool getGhstd() const;
+	/**
+	 * @brief Returns the number of scans in which ghosting was found.
+	 *
+	 * @return The number of scans.
+	 */
+	const uint32_t getGhstsCnt() const;
+	/**
+	 * @brief see MpbInptSrc::getInptSt(const uint16_t &)
+	 */
+	virtual bool getInptSt(const uint16_t &inptIdx);
+	/**
+	 * @brief Returns the input index of a key, given it's row and column.
+	 *
+	 * @param row Row of the key.
+	 * @param col Column of the key.
+	 *
+	 * @return The input index of the key.
+	 * @retval 0xFFFF: The row or the column are not valid.
+	 */
+	uint16_t getKeyIdx(const uint8_t &row, const uint8_t &col);
+	/**
+	 * @brief Copies the keys states image to an array.
+	 *
+	 * @param keysBtmp Pointer to an array of uint32_t to receive the keys states bitmap, key i being bit (i % 32) of element (i / 32). The array must hold at least ((getInptsCnt() + 31) / 32) elements.
+	 */
+	void getKeysBtmp(uint32_t* keysBtmp);
+	/**
+	 * @brief Returns the number of rows of the matrix.
+	 *
+	 * @return The number of rows.
+	 */
+	const uint8_t getRowsCnt() const;
+	/**
+	 * @brief Scans the matrix, refreshing the keys states image.
+	 *
+	 * Each row is driven to low level in turn, the settle reads are executed, the columns ports are read and the row is released before driving the next one.
+	 *
+	 * @param curTm Current time in milliseconds, as kept by the application.
+	 */
+	virtual void scan(const unsigned long int &curTm);
+	/**
+	 * @brief Sets the ghosting detection attribute flag.
+	 *
+	 * @param newGhstDtctn If true -the default value- ghosting is detected, if false -only for matrices built with a diode per key- the scanned states are always used.
+	 */
+	void setGhstDtctn(const bool &newGhstDtctn);
+	/**
+	 * @brief Sets the number of dummy columns port reads executed after driving each row.
+	 *
+	 * The reads give the columns lines -loaded by the keys and wiring capacitance and pulled up by the weak internal resistors- the time needed to settle before being read. The default value is _MpbMtrxStdSttlRds.
+	 *
+	 * @param newSttlRds The number of settle reads.
+	 */
+	void setSttlRds(const uint8_t &newSttlRds);
+};
+
+//==========================================================>>
+
+/**
+ * @brief Models a GPIO port input source: several pins of a GPIO port read by a single input data register access.
+ *
+ * Each scan reads the port once, so all the objects bound to the port pins are updated with a coherent image of the port, taken at the same time, and with a single peripheral access instead of one per object. The input index of each pin is it's pin number (0 to 15).
+ *
+ * @class MpbGpioPortInptSrc
+ */
+class MpbGpioPortInptSrc: public MpbInptSrc{
+protected:
+	uint16_t _pinsMsk{0};
+	GPIO_TypeDef* _port{nullptr};
+	uint16_t _portImg{0};
+	bool _pulledUp{true};
+public:
+	/**
+	 * @brief Class constructor
+	 *
+	 * The pins are configured as inputs with the internal pull-up or pull-down resistors. The GPIO port clock must be already enabled.
+	 *
+	 * @param port GPIO port of the input pins.
+	 * @param pinsMsk Mask of the input pins, each set bit identifying an input pin.
+	 * @param pulledUp (Optional) If true -the default value- the pins are pulled up and an input is active at low level, if false the pins are pulled down and an input is active at high level.
+	 */
+	MpbGpioPortInptSrc(GPIO_TypeDef* port, const uint16_t &pinsMsk, const bool &pulledUp = true);
+	/**
+	 * @brief Class virtual destructor
+	 */
+	virtual ~MpbGpioPortInptSrc();
+	/**
+	 * @brief see MpbInptSrc::getInptSt(const uint16_t &)
+	 *
+	 * @note Only the inputs of the pins included in the pins mask might be active.
+	 */
+	virtual bool getInptSt(const uint16_t &inptIdx);
+	/**
+	 * @brief Returns the mask of the input pins.
+	 *
+	 * @return The pins mask.
+	 */
+	const uint16_t getPinsMsk() const;
+	/**
+	 * @brief Reads the port input data register, refreshing the inputs image.
+	 *
+	 * @param curTm Current time in milliseconds, as kept by the application.
+	 */
+	virtual void scan(const unsigned long int &curTm);
+};
+
+//==========================================================>>
+
+/**
+ * @brief Models a software input source: inputs whose states are written by the application, for signals not read from a GPIO pin -fieldbus coils, remote commands, values computed by other tasks-.
+ *
+ * Each input is a **software pin**, kept as a single byte written by a single store instruction, so it might be written from any task or ISR with no critical section, lock or read-modify-write, and it's read by the bound objects with no lock either. The inputs are read directly, so no scan is needed, and the objects bound to them might be updated by any mechanism, including their own timers.
+ *
+ * @class MpbSwInptSrc
+ */
+class MpbSwInptSrc: public MpbInptSrc{
+protected:
+	volatile uint8_t _swInpts[_MpbSwInptsMaxQty]{};
+public:
+	/**
+	 * @brief Class constructor
+	 *
+	 * The inputs are set to inactive state.
+	 *
+	 * @param inptsCnt (Optional) Number of inputs, up to _MpbSwInptsMaxQty. Default value is 1.
+	 */
+	MpbSwInptSrc(const uint16_t &inptsCnt = 1);
+	/**
+	 * @brief Class virtual destructor
+	 */
+	virtual ~MpbSwInptSrc();
+	/**
+	 * @brief see MpbInptSrc::getInptSt(const uint16_t &)
+	 */
+	virtual bool getInptSt(const uint16_t &inptIdx);
+	/**
+	 * @brief Counts the scan, the inputs are read directly so there's no image to refresh.
+	 *
+	 * @param curTm Current time in milliseconds, as kept by the application.
+	 */
+	virtual void scan(const unsigned long int &curTm);
+	/**
+	 * @brief Writes the state of a software pin.
+	 *
+	 * The method might be invoked from any task or ISR.
+	 *
+	 * @param inptIdx Index of the input.
+	 * @param newInptSt The new state of the input, true for active.
+	 *
+	 * @retval true: The input state was written.
+	 * @retval false: The index is not valid.
+	 */
+	bool setInptSt(const uint16_t &inptIdx, const bool &newInptSt);
+};
+
+//==========================================================>>
+
+/**
+ * @brief Abstract class, models an input source built by a chain of parallel-in/serial-out 8 bits shift registers (74HC165 or equivalent), read in a single burst.
+ *
+ * Up to _MpbShftRgstrMaxRgstrs registers might be chained, providing up to 64 inputs. Each scan latches the registers parallel inputs and shifts the complete chain in, refreshing the inputs image. The first byte shifted in is the one of the register whose serial output is connected to the MCU, the bytes are received MSB first, so the input index of the parallel input n (A=0 ... H=7) of the register received in the byte i is (i * 8 + n).
+ *
+ * The chain might be read:
+ * - **Synchronously**: each scan executes a blocking read of the chain, the image reflects the inputs at the scan time.
+ * - **Asynchronously**: each scan refreshes the image with the data of the last completed read -if any- and starts a new read, whose completion must be signaled by invoking rxCpltIsr() (or rxErrIsr()). The scan returns immediately, the image is one polling cycle old.
+ *
+ * The subclasses provide the chain reading mechanisms: MpbHalSpiShftRgstrInptSrc for the STM32 HAL SPI peripheral, and MpbHostShftRgstrInptSrc as a simulated stand-in for off-target (host) execution and testing.
+ *
+ * @class MpbShftRgstrInptSrc
+ */
+class MpbShftRgstrInptSrc: public MpbInptSrc{
+protected:
+	bool _actvLow{true};
+	bool _asyncRd{false};
+	uint32_t _inptsBtmp[(_MpbShftRgstrMaxRgstrs * 8 + 31) / 32]{};
+	uint32_t _rdErrsCnt{0};
+	uint8_t _rgstrsCnt{0};
+	volatile bool _rxBsy{false};
+	uint8_t _rxBuf[_MpbShftRgstrMaxRgstrs]{};
+	volatile bool _rxCmplt{false};
+
+	virtual bool _rdRgstrs(uint8_t* rxBuf) = 0;
+	virtual bool _strtRdRgstrs(uint8_t* rxBuf) = 0;
+	void _updImg();
+public:
+	/**
+	 * @brief Class constructor
+	 *
+	 * @param rgstrsCnt Number of chained shift registers, the number of inputs is 8 times this value. Values greater than _MpbShftRgstrMaxRgstrs build a source with no inputs.
+	 * @param actvLow (Optional) If true -the default value- an input is active when it's level is low (contacts closing to ground with pull-up resistors), if false an input is active when it's level is high.
+	 */
+	MpbShftRgstrInptSrc(const uint8_t &rgstrsCnt, const bool &actvLow = true);
+	/**
+	 * @brief Class virtual destructor
+	 */
+	virtual ~MpbShftRgstrInptSrc();
+	/**
+	 * @brief Returns the value of the asynchronous read attribute flag.
+	 *
+	 * @retval true: The chain is read asynchronously.
+	 * @retval false: The chain is read synchronously.
+	 */
+	const bool getAsyncRd() const;
+	/**
+	 * @brief see MpbInptSrc::getInptSt(const uint16_t &)
+	 */
+	virtual bool getInptSt(const uint16_t &inptIdx);
+	/**
+	 * @brief Copies the inputs states image to an array.
+	 *
+	 * @param inptsBtmp Pointer to an array of uint32_t to receive the inputs states bitmap, input i being bit (i % 32) of element (i / 32). The array must hold at least ((getInptsCnt() + 31) / 32) elements.
+	 */
+	void getInptsBtmp(uint32_t* inptsBtmp);
+	/**
+	 * @brief Returns the number of failed chain reads.
+	 *
+	 * @return The number of failed reads, including the reads that could not be started.
+	 */
+	const uint32_t getRdErrsCnt() const;
+	/**
+	 * @brief Returns the number of chained shift registers.
+	 *
+	 * @return The number of registers.
+	 */
+	const uint8_t getRgstrsCnt() const;
+	/**
+	 * @brief Signals the completion of an asynchronous chain read.
+	 *
+	 * The method must be invoked by the read completion ISR, i.e. from the HAL_SPI_RxCpltCallback() function.
+	 */
+	void rxCpltIsr();
+	/**
+	 * @brief Signals the failure of an asynchronous chain read.
+	 *
+	 * The method must be invoked by the read error ISR, i.e. from the HAL_SPI_ErrorCallback() function. The image keeps the last read states.
+	 */
+	void rxErrIsr();
+	/**
+	 * @brief Reads the chain, refreshing the inputs image. See the class description for the synchronous and asynchronous reading modes.
+	 *
+	 * @param curTm Current time in milliseconds, as kept by the application.
+	 */
+	virtual void scan(const unsigned long int &curTm);
+	/**
+	 * @brief Sets the asynchronous read attribute flag.
+	 *
+	 * @param newAsyncRd If true the chain is read asynchronously, if false -the default value- the chain is read synchronously.
+	 *
+	 * @note The mode must not be changed while an asynchronous read is in progress, the change is ignored in that case.
+	 */
+	void setAsyncRd(const bool &newAsyncRd);
+};
+
+//==========================================================>>
+
+#ifdef HAL_SPI_MODULE_ENABLED
+/**
+ * @brief Models a shift registers chain input source read by a STM32 SPI peripheral, using the HAL SPI services.
+ *
+ * The SPI peripheral must be configured by the application -i.e. by the CubeMX generated code- as a receive only master, 8 bits data size, MSB first, clock polarity low and first edge clock phase, with the registers serial output connected to MISO and the SPI clock to the registers clock input (clock inhibit input tied low). For the asynchronous read mode a DMA stream must be linked to the SPI reception, and the rxCpltIsr() method invoked from the HAL_SPI_RxCpltCallback() function when the SPI handle received as argument is the one returned by getSpi().
+ *
+ * The registers shift/load input is driven by a GPIO pin, pulsed low before every read to latch the parallel inputs. Two back to back GPIO writes give a pulse of just a few nanoseconds, shorter than the registers minimum load pulse width -about 20 ns for a 74HC165 at 4.5V, longer at lower supply voltages-, so the pulse is stretched by a configurable number of dummy port reads (see setLdSttlRds(const uint8_t &)).
+ *
+ * @class MpbHalSpiShftRgstrInptSrc
+ */
+class MpbHalSpiShftRgstrInptSrc: public MpbShftRgstrInptSrc{
+protected:
+	SPI_HandleTypeDef* _hspi{nullptr};
+	gpioPinId_t _ldPin{};
+	uint8_t _ldSttlRds{_MpbShftRgstrStdLdSttlRds};
+
+	void _ldRgstrs();
+	virtual bool _rdRgstrs(uint8_t* rxBuf);
+	virtual bool _strtRdRgstrs(uint8_t* rxBuf);
+public:
+	/**
+	 * @brief Class constructor
+	 *
+	 * @param hspi Pointer to the HAL handle of the already configured SPI peripheral.
+	 * @param ldPin The GPIO pin connected to the registers shift/load input. The pin is configured as a push-pull output, the GPIO port clock must be already enabled.
+	 * @param rgstrsCnt Number of chained shift registers.
+	 * @param actvLow (Optional) See MpbShftRgstrInptSrc(const uint8_t &, const bool &).
+	 */
+	MpbHalSpiShftRgstrInptSrc(SPI_HandleTypeDef* hspi, gpioPinId_t ldPin, const uint8_t &rgstrsCnt, const bool &actvLow = true);
+	/**
+	 * @brief Class virtual destructor
+	 */
+	virtual ~MpbHalSpiShftRgstrInptSrc();
+	/**
+	 * @brief Returns the HAL handle of the SPI peripheral used to read the chain.
+	 *
+	 * @return The pointer to the SPI handle.
+	 */
+	SPI_HandleTypeDef* getSpi();
+	/**
+	 * @brief Sets the number of dummy load pin port reads executed while the shift/load input is held low.
+	 *
+	 * Each read takes at least a GPIO bus access, the reads stretch the load pulse to the registers minimum load pulse width. The default value is _MpbShftRgstrStdLdSttlRds, enough for a 74HC165 powered at 3.3V with core clocks up to about 200 MHz, faster cores or lower supply voltages might need more reads.
+	 *
+	 * @param newLdSttlRds The number of settle reads.
+	 */
+	void setLdSttlRds(const uint8_t &newLdSttlRds);
+};
+#endif
+
+//==========================================================>>
+
+/**
+ * @brief Models a simulated shift registers chain input source, a stand-in for the SPI source to be used for off-target (host) execution and testing.
+ *
+ * The levels at the registers parallel inputs are set by the setSimInpt(const uint16_t &, const bool &) and setSimRgstr(const uint8_t &, const uint8_t &) methods. The levels are latched when each read starts, for the asynchronous mode the read is completed by the cmpltSimRd() method, that stands in for the DMA transfer completion interrupt.
+ *
+ * @class MpbHostShftRgstrInptSrc
+ */
+class MpbHostShftRgstrInptSrc: public MpbShftRgstrInptSrc{
+protected:
+	uint8_t _simLtchd[_MpbShftRgstrMaxRgstrs]{};
+	uint8_t _simRgstrs[_MpbShftRgstrMaxRgstrs]{};
+	uint8_t* _simRxBuf{nullptr};
+
+	virtual bool _rdRgstrs(uint8_t* rxBuf);
+	virtual bool _strtRdRgstrs(uint8_t* rxBuf);
+public:
+	/**
+	 * @brief Class constructor
+	 *
+	 * The simulated parallel inputs are set to high level, the inactive level for the default active low inputs.
+	 *
+	 * @param rgstrsCnt Number of simulated chained shift registers.
+	 * @param actvLow (Optional) See MpbShftRgstrInptSrc(const uint8_t &, const bool &).
+	 */
+	MpbHostShftRgstrInptSrc(const uint8_t &rgstrsCnt, const bool &actvLow = true);
+	/**
+	 * @brief Class virtual destructor
+	 */
+	virtual ~MpbHostShftRgstrInptSrc();
+	/**
+	 * @brief Completes the simulated asynchronous read in progress, invoking rxCpltIsr().
+	 *
+	 * @retval true: A read was in progress and was completed.
+	 * @retval false: No read was in progress.
+	 */
+	bool cmpltSimRd();
+	/**
+	 * @brief Sets the level of a simulated parallel input.
+	 *
+	 * @param inptIdx Index of the input.
+	 * @param newLvl The input level, true for high level.
+	 */
+	void setSimInpt(const uint16_t &inptIdx, const bool &newLvl);
+	/**
+	 * @brief Sets the levels of all the parallel inputs of a simulated register.
+	 *
+	 * @param rgstrIdx Index of the register, in the reception order.
+	 * @param newVal The inputs levels, input A being the bit 0.
+	 */
+	void setSimRgstr(const uint8_t &rgstrIdx, const uint8_t &newVal);
+};
+
+//==========================================================>>
+
+/**
+ * @brief Abstract class, models a resistor ladder input source: several buttons connected through a resistor ladder to a single ADC input, each button producing a different voltage level when pressed.
+ *
+ * Each scan takes **one** ADC sample and classifies it into a button code: the index of the button whose nominal level is within the tolerance range of the sample, or the idle code if the sample is within the tolerance range of the idle -no button pressed- level. As only one button of a ladder can be identified at a time, one input at most is active in the image.
+ *
+ * The classification is protected against noise and transients by:
+ * - **Median filter**: the classified value is the median of the last three samples, discarding isolated spikes without the slew through intermediate levels an averaging filter would produce.
+ * - **Hysteresis**: the current code is kept while the value stays within the tolerance range of it's level widened by the hysteresis value, so a value near a range limit doesn't make the code chatter.
+ * - **Confirmation**: a new code is accepted only after being classified in a number of consecutive scans, discarding the intermediate levels crossed while a button contact is closing or opening.
+ * - **Invalid samples**: values outside every range don't change the code, they are counted for diagnostic purposes.
+ *
+ * The subclasses provide the ADC reading mechanisms: MpbHalAdcLddrInptSrc for the STM32 HAL ADC peripheral, and MpbHostAdcLddrInptSrc as a simulated stand-in for off-target (host) execution and testing.
+ *
+ * @class MpbAdcLddrInptSrc
+ */
+class MpbAdcLddrInptSrc: public MpbInptSrc{
+protected:
+	uint16_t _bttnsLvls[_MpbAdcLddrMaxBttns]{};
+	uint8_t _cndtCode{0xFF};
+	uint8_t _cndtScnsCnt{0};
+	uint8_t _cnfrmScns{2};
+	uint8_t _curCode{0xFF};
+	uint16_t _fltrdVal{0};
+	uint16_t _hyst{0};
+	uint16_t _idleLvl{0};
+	uint32_t _invldSmplsCnt{0};
+	bool _mdnFltr{true};
+	uint16_t _smpls[3]{};
+	uint8_t _smplsCnt{0};
+	uint16_t _tlrnc{0};
+
+	uint8_t _clssfy(const uint16_t &val);
+	bool _inRng(const uint16_t &val, const uint16_t &lvl, const uint16_t &rng);
+	virtual bool _rdAdc(uint16_t &adcVal) = 0;
+public:
+	/**
+	 * @brief Class constructor
+	 *
+	 * @param bttnsLvls Array of the nominal ADC values produced by each button when pressed, the button index being it's input index.
+	 * @param bttnsCnt Number of buttons of the ladder. Values greater than _MpbAdcLddrMaxBttns build a source with no inputs.
+	 * @param idleLvl Nominal ADC value when no button is pressed.
+	 * @param tlrnc Tolerance: maximum difference between a sample value and a nominal value for the sample to be classified to that nominal value. The tolerance ranges of adjacent levels must not overlap.
+	 * @param hyst (Optional) Hysteresis: value added to the tolerance of the current code level while it's kept. Default value is 0.
+	 */
+	MpbAdcLddrInptSrc(const uint16_t* bttnsLvls, const uint8_t &bttnsCnt, const uint16_t &idleLvl, const uint16_t &tlrnc, const uint16_t &hyst = 0);
+	/**
+	 * @brief Class virtual destructor
+	 */
+	virtual ~MpbAdcLddrInptSrc();
+	/**
+	 * @brief Returns the number of consecutive scans a new code must be classified to be accepted.
+	 *
+	 * @return The number of confirmation scans.
+	 */
+	const uint8_t getCnfrmScns() const;
+	/**
+	 * @brief Returns the current button code.
+	 *
+	 * @return The index of the pressed button.
+	 * @retval 0xFF: No button is pressed.
+	 */
+	const uint8_t getCurCode() const;
+	/**
+	 * @brief Returns the last filtered ADC value, the value used for the classification.
+	 *
+	 * The value is provided for the ladder levels calibration and diagnostic.
+	 *
+	 * @return The filtered value.
+	 */
+	const uint16_t getFltrdVal() const;
+	/**
+	 * @brief see MpbInptSrc::getInptSt(const uint16_t &)
+	 */
+	virtual bool getInptSt(const uint16_t &inptIdx);
+	/**
+	 * @brief Returns the number of samples not classified to any level.
+	 *
+	 * @return The number of invalid samples.
+	 */
+	const uint32_t getInvldSmplsCnt() const;
+	/**
+	 * @brief Returns the value of the median filter attribute flag.
+	 *
+	 * @retval true: The samples are median filtered.
+	 * @retval false: The samples are classified unfiltered.
+	 */
+	const bool getMdnFltr() const;
+	/**
+	 * @brief Takes an ADC sample and classifies it, refreshing the inputs image.
+	 *
+	 * @param curTm Current time in milliseconds, as kept by the application.
+	 */
+	virtual void scan(const unsigned long int &curTm);
+	/**
+	 * @brief Sets the number of consecutive scans a new code must be classified to be accepted.
+	 *
+	 * @param newCnfrmScns The number of confirmation scans, 1 accepts the new code in the first scan it's classified. Default value is 2.
+	 *
+	 * @retval true: The value was set.
+	 * @retval false: The value was 0, the value was not changed.
+	 */
+	bool setCnfrmScns(const uint8_t &newCnfrmScns);
+	/**
+	 * @brief Sets the median filter attribute flag.
+	 *
+	 * @param newMdnFltr If true -the default value- the samples are median filtered, if false the samples are classified unfiltered.
+	 */
+	void setMdnFltr(const bool &newMdnFltr);
+};
+
+//==========================================================>>
+
+#ifdef HAL_ADC_MODULE_ENABLED
+/**
+ * @brief Models a resistor ladder input source read by a STM32 ADC peripheral, using the HAL ADC services.
+ *
+ * The ADC must be configured by the application -i.e. by the CubeMX generated code- for single conversion of the ladder channel, software triggered. Each scan starts a conversion and polls for it's completion.
+ *
+ * @class MpbHalAdcLddrInptSrc
+ */
+class MpbHalAdcLddrInptSrc: public MpbAdcLddrInptSrc{
+protected:
+	ADC_HandleTypeDef* _hadc{nullptr};
+
+	virtual bool _rdAdc(uint16_t &adcVal);
+public:
+	/**
+	 * @brief Class constructor
+	 *
+	 * @param hadc Pointer to the HAL handle of the already configured ADC peripheral.
+	 *
+	 * For the rest of the parameters see MpbAdcLddrInptSrc(const uint16_t*, const uint8_t &, const uint16_t &, const uint16_t &, const uint16_t &).
+	 */
+	MpbHalAdcLddrInptSrc(ADC_HandleTypeDef* hadc, const uint16_t* bttnsLvls, const uint8_t &bttnsCnt, const uint16_t &idleLvl, const uint16_t &tlrnc, const uint16_t &hyst = 0);
+	/**
+	 * @brief Class virtual destructor
+	 */
+	virtual ~MpbHalAdcLddrInptSrc();
+	/**
+	 * @brief Returns the HAL handle of the ADC peripheral used to read the ladder.
+	 *
+	 * @return The pointer to the ADC handle.
+	 */
+	ADC_HandleTypeDef* getAdc();
+};
+#endif
+
+//==========================================================>>
+
+/**
+ * @brief Models a simulated resistor ladder input source, a stand-in for the ADC source to be used for off-target (host) execution and testing.
+ *
+ * The value returned by the simulated ADC is set by the setSimVal(const uint16_t &) method.
+ *
+ * @class MpbHostAdcLddrInptSrc
+ */
+class MpbHostAdcLddrInptSrc: public MpbAdcLddrInptSrc{
+protected:
+	uint16_t _simVal{0};
+
+	virtual bool _rdAdc(uint16_t &adcVal);
+public:
+	/**
+	 * @brief Class constructor
+	 *
+	 * The simulated ADC value is set to the idle level. For the parameters see MpbAdcLddrInptSrc(const uint16_t*, const uint8_t &, const uint16_t &, const uint16_t &, const uint16_t &).
+	 */
+	MpbHostAdcLddrInptSrc(const uint16_t* bttnsLvls, const uint8_t &bttnsCnt, const uint16_t &idleLvl, const uint16_t &tlrnc, const uint16_t &hyst = 0);
+	/**
+	 * @brief Class virtual destructor
+	 */
+	virtual ~MpbHostAdcLddrInptSrc();
+	/**
+	 * @brief Sets the simulated ADC conversion value.
+	 *
+	 * @param newSimVal The value returned by the following conversions.
+	 */
+	void setSimVal(const uint16_t &newSimVal);
+};
+
+/**
+ * @brief Models a dual channel input source: safety rated buttons with two redundant contacts -usually one NO and one NC- each wired to it's own pin, with **discrepancy monitoring**.
+ *
+ * Each input of the source is a **pair** of channels. In every scan all the channels are read from a single snapshot of their ports -one input data register access per port- and each pair is checked in the same pass:
+ * - When both channels agree, the input takes their common state (actuated or not actuated).
+ * - When the channels disagree, the input keeps it's last agreed state. If the discrepancy lasts longer than the **discrepancy time** a **fault** is latched for the pair.
+ *
+ * While a pair is faulted it's input is forced to the fault input state (by default not active) whatever the channels state, so the objects bound to it are driven to a known state through their own automatons. A fault is cleared only by rstFlt(const uint8_t &), accepted when both channels agree in the not actuated state. As the monitoring is executed as part of the scan, it adds no timer and no extra port reads.
+ *
+ * The input index of each pair is it's position in the pins arrays passed to the constructor. The source inputs feed the DbncdMPBttn class and subclasses objects as any other input source, the objects must be bound as Normally Open, as the source provides the actuated state.
+ *
+ * @class MpbDualChnlInptSrc
+ */
+class MpbDualChnlInptSrc: public MpbInptSrc{
+protected:
+	uint8_t _actBtmp[2]{};
+	gpioPinId_t _chnlsPins[2][_MpbDualChnlMaxPairs]{};
+	uint8_t _chnlsPortIdx[2][_MpbDualChnlMaxPairs]{};
+	bool _chnlBNC{true};
+	uint32_t _dscrpncsCnt{0};
+	uint8_t _dscrpncyBtmp{0};
+	unsigned long int _dscrpncyStrt[_MpbDualChnlMaxPairs]{};
+	unsigned long int _dscrpncyTm{_MpbDualChnlStdDscrpncyTm};
+	bool _fltInptSt{false};
+	uint8_t _fltsBtmp{0};
+	uint32_t _fltsCnt{0};
+	uint8_t _inptsBtmp{0};
+	GPIO_TypeDef* _ports[2 * _MpbDualChnlMaxPairs]{};
+	uint8_t _portsCnt{0};
+	bool _pulledUp{true};
+public:
+	/**
+	 * @brief Class constructor
+	 *
+	 * The channels pins are configured as inputs with the internal pull-up or pull-down resistors. The GPIO ports clocks must be already enabled.
+	 *
+	 * @param chnlAPins Array of the channel A pins, one for each pair. Channel A is always a NO contact: it's active when the button is actuated.
+	 * @param chnlBPins Array of the channel B pins, one for each pair.
+	 * @param pairsCnt Number of pairs, up to _MpbDualChnlMaxPairs. Invalid values build a source with no inputs.
+	 * @param chnlBNC (Optional) If true -the default value- channel B is a NC contact, active when the button is not actuated, if false it's a NO contact as channel A.
+	 * @param pulledUp (Optional) If true -the default value- the pins are pulled up and a contact is active -closed- at low level, if false the pins are pulled down and a contact is active at high level.
+	 */
+	MpbDualChnlInptSrc(gpioPinId_t* chnlAPins, gpioPinId_t* chnlBPins, const uint8_t &pairsCnt, const bool &chnlBNC = true, const bool &pulledUp = true);
+	/**
+	 * @brief Class virtual destructor
+	 */
+	virtual ~MpbDualChnlInptSrc();
+	/**
+	 * @brief Returns the number of discrepancies detected, including the ones resolved inside the discrepancy time.
+	 *
+	 * @return The number of discrepancies.
+	 */
+	const uint32_t getDscrpncsCnt() const;
+	/**
+	 * @brief Returns the pairs with their channels currently in disagreement.
+	 *
+	 * @return The bitmap of the pairs in discrepancy, bit 0 for pair 0.
+	 */
+	const uint8_t getDscrpncyBtmp() const;
+	/**
+	 * @brief Returns the discrepancy time.
+	 *
+	 * @return The maximum time, in milliseconds, the channels of a pair might disagree before a fault is latched.
+	 */
+	const unsigned long int getDscrpncyTm() const;
+	/**
+	 * @brief Returns the fault condition of a pair.
+	 *
+	 * @param pairIdx Index of the pair.
+	 *
+	 * @retval true: The pair has a latched fault.
+	 * @retval false: The pair has no latched fault, or the index is not valid.
+	 */
+	const bool getFlt(const uint8_t &pairIdx) const;
+	/**
+	 * @brief Returns the input state provided for the faulted pairs.
+	 *
+	 * @return The input state of the faulted pairs.
+	 */
+	const bool getFltInptSt() const;
+	/**
+	 * @brief Returns the latched faults of all the pairs.
+	 *
+	 * @return The bitmap of the faulted pairs, bit 0 for pair 0.
+	 */
+	const uint8_t getFltsBtmp() const;
+	/**
+	 * @brief Returns the number of faults latched since instantiation.
+	 *
+	 * @return The number of faults.
+	 */
+	const uint32_t getFltsCnt() const;
+	/**
+	 * @brief see MpbInptSrc::getInptSt(const uint16_t &)
+	 *
+	 * @note The input state is the agreed actuated state of the pair channels, or the fault input state if the pair is faulted.
+	 */
+	virtual bool getInptSt(const uint16_t &inptIdx);
+	/**
+	 * @brief Clears the latched fault of a pair.
+	 *
+	 * @param pairIdx Index of the pair.
+	 *
+	 * @retval true: The fault was cleared, or the pair was not faulted.
+	 * @retval false: The index is not valid, or the channels don't agree in the not actuated state, the fault is kept.
+	 */
+	bool rstFlt(const uint8_t &pairIdx);
+	/**
+	 * @brief Reads the channels ports, refreshing the inputs image and monitoring the channels discrepancies.
+	 *
+	 * @param curTm Current time in milliseconds, as kept by the application.
+	 */
+	virtual void scan(const unsigned long int &curTm);
+	/**
+	 * @brief Sets the discrepancy time.
+	 *
+	 * @param newVal The maximum time, in milliseconds, the channels of a pair might disagree before a fault is latched. Default value is _MpbDualChnlStdDscrpncyTm.
+	 */
+	void setDscrpncyTm(const unsigned long int &newVal);
+	/**
+	 * @brief Sets the input state provided for the faulted pairs.
+	 *
+	 * The safe state depends on the button function: not active (the default value) for buttons enabling a dangerous movement, active for stop buttons.
+	 *
+	 * @param newVal The input state of the faulted pairs.
+	 */
+	void setFltInptSt(const bool &newVal);
 };
 
 //==========================================================>>
@@ -0,0 +1,201 @@
+/**
+  ******************************************************************************
+  * @file	: TwoHndMPBttn_test.cpp
+  * @brief	: Host test for the ButtonToSwitch for STM32 library TwoHndMPBttn class
+  *
+  * The two-hand control channels are bound to a MpbSwInptSrc software input
+  * source, and the object is updated by invoking update(curTm) with a simulated
+  * 1 millisecond time base, so the test runs off-target with the minimal HAL
+  * stand-in provided in the stubs folder and the library bare-metal build.
+  *
+  * Build and run from the library folder -named ButtonToSwitch_STM32, as the
+  * library source includes it's header by that path-:
+  *
+  * 	g++ -std=c++17 -DMPB_BARE_METAL -Itest/stubs test/TwoHndMPBttn_test.cpp test/stubs/stm32f4xx_hal.cpp src/ButtonToSwitch_STM32.cpp -o TwoHndMPBttn_test && ./TwoHndMPBttn_test
+  *
+  * The exit status is 0 if all the checks passed, 1 otherwise.
+  *
+  ******************************************************************************
+  */
+#include "stm32f4xx_hal.h"
+#include "../src/ButtonToSwitch_STM32.h"
+
+#include <stdio.h>
+
+static unsigned long int curTm {0};
+static uint32_t fldChcks {0};
+
+static void chck(const bool &cond, const char* dscr){
+	if(!cond){
+		printf("FAIL: %s (t = %lu ms)\n", dscr, curTm);
+		++fldChcks;
+	}
+
+	return;
+}
+
+//Polls the object every millisecond for the given time, the source being scanned before each poll as a MpbGrp would do
+static void run(MpbSwInptSrc &inptSrc, TwoHndMPBttn &thc, const unsigned long int &tmLps){
+	for(unsigned long int i{0}; i < tmLps; ++i){
+		inptSrc.scan(curTm);
+		thc.update(curTm);
+		++curTm;
+	}
+
+	return;
+}
+
+static void setChnls(MpbSwInptSrc &inptSrc, const bool &lftSt, const bool &rghtSt){
+	inptSrc.setInptSt(0, lftSt);
+	inptSrc.setInptSt(1, rghtSt);
+
+	return;
+}
+
+static void tstSmltnsPrss(){
+	MpbSwInptSrc inptSrc(2);
+	TwoHndMPBttn thc(gpioPinId_t{NULL, _InvalidPinNum}, gpioPinId_t{NULL, _InvalidPinNum});
+
+	thc.setChnlsInptSrc(&inptSrc, 0, 1);
+	run(inptSrc, thc, 50);
+	chck(thc.getTwoHndStt() == TwoHndMPBttn::thArmd, "Simultaneous press: armed at start");
+	setChnls(inptSrc, true, true);
+	run(inptSrc, thc, 100);
+	chck(thc.getIsOn(), "Simultaneous press: output set");
+	chck(thc.getTwoHndStt() == TwoHndMPBttn::thOn, "Simultaneous press: thOn state");
+	chck(thc.getCyclsCnt() == 1, "Simultaneous press: one cycle counted");
+	chck(thc.getSmltntyFlsCnt() == 0, "Simultaneous press: no simultaneity failure");
+
+	return;
+}
+
+static void tstLtPrssBlcks(){
+	MpbSwInptSrc inptSrc(2);
+	TwoHndMPBttn thc(gpioPinId_t{NULL, _InvalidPinNum}, gpioPinId_t{NULL, _InvalidPinNum});
+
+	thc.setChnlsInptSrc(&inptSrc, 0, 1);
+	run(inptSrc, thc, 50);
+	setChnls(inptSrc, true, false);
+	run(inptSrc, thc, 100);
+	chck(thc.getTwoHndStt() == TwoHndMPBttn::thWtng, "Late press: waiting for the second channel");
+	run(inptSrc, thc, _TwoHndStdSmltntyWndw + 100);
+	setChnls(inptSrc, true, true);
+	run(inptSrc, thc, 100);
+	chck(!thc.getIsOn(), "Late press: output not set");
+	chck(thc.getTwoHndStt() == TwoHndMPBttn::thBlckd, "Late press: cycle blocked");
+	chck(thc.getSmltntyFlsCnt() == 1, "Late press: simultaneity failure counted");
+	chck(thc.getCyclsCnt() == 0, "Late press: no cycle counted");
+
+	return;
+}
+
+static void tstRlsDrpsOtpt(){
+	MpbSwInptSrc inptSrc(2);
+	TwoHndMPBttn thc(gpioPinId_t{NULL, _InvalidPinNum}, gpioPinId_t{NULL, _InvalidPinNum});
+
+	thc.setChnlsInptSrc(&inptSrc, 0, 1);
+	run(inptSrc, thc, 50);
+	for(uint8_t rlsdChnl{0}; rlsdChnl < 2; ++rlsdChnl){
+		setChnls(inptSrc, true, true);
+		run(inptSrc, thc, 100);
+		chck(thc.getIsOn(), "Release: output set");
+		setChnls(inptSrc, rlsdChnl != 0, rlsdChnl != 1);
+		run(inptSrc, thc, 50);
+		chck(!thc.getIsOn(), (rlsdChnl == 0)?"Release: left release drops the output":"Release: right release drops the output");
+		setChnls(inptSrc, false, false);
+		run(inptSrc, thc, 50);
+	}
+
+	return;
+}
+
+static void tstRarm(){
+	MpbSwInptSrc inptSrc(2);
+	TwoHndMPBttn thc(gpioPinId_t{NULL, _InvalidPinNum}, gpioPinId_t{NULL, _InvalidPinNum});
+
+	thc.setChnlsInptSrc(&inptSrc, 0, 1);
+	run(inptSrc, thc, 50);
+	setChnls(inptSrc, true, true);
+	run(inptSrc, thc, 100);
+	setChnls(inptSrc, true, false);
+	run(inptSrc, thc, 50);
+	setChnls(inptSrc, true, true);
+	run(inptSrc, thc, 100);
+	chck(!thc.getIsOn(), "Re-arm: re-pressing one channel doesn't set the output");
+	chck(thc.getTwoHndStt() == TwoHndMPBttn::thBlckd, "Re-arm: blocked until both channels are released");
+	setChnls(inptSrc, false, true);
+	run(inptSrc, thc, 50);
+	chck(thc.getTwoHndStt() == TwoHndMPBttn::thBlckd, "Re-arm: still blocked with one channel pressed");
+	setChnls(inptSrc, false, false);
+	run(inptSrc, thc, 50);
+	chck(thc.getTwoHndStt() == TwoHndMPBttn::thArmd, "Re-arm: armed after both channels are released");
+	setChnls(inptSrc, true, true);
+	run(inptSrc, thc, 100);
+	chck(thc.getIsOn(), "Re-arm: new cycle sets the output");
+	chck(thc.getCyclsCnt() == 2, "Re-arm: two cycles counted");
+
+	return;
+}
+
+static void tstBnc(){
+	MpbSwInptSrc inptSrc(2);
+	TwoHndMPBttn thc(gpioPinId_t{NULL, _InvalidPinNum}, gpioPinId_t{NULL, _InvalidPinNum});
+
+	thc.setChnlsInptSrc(&inptSrc, 0, 1);
+	run(inptSrc, thc, 50);
+	inptSrc.setInptSt(1, true);
+	for(uint8_t i{0}; i < 6; ++i){	//Left channel contact bouncing, each level shorter than the debounce time
+		inptSrc.setInptSt(0, (i % 2) == 0);
+		run(inptSrc, thc, 3);
+	}
+	chck(!thc.getChnlSt(0), "Bounce: bouncing channel not taken as pressed");
+	inptSrc.setInptSt(0, true);
+	run(inptSrc, thc, 100);
+	chck(thc.getIsOn(), "Bounce: output set once the channel is stable");
+	chck(thc.getSmltntyFlsCnt() == 0, "Bounce: no simultaneity failure");
+	inptSrc.setInptSt(0, false);	//Release glitch shorter than the debounce time
+	run(inptSrc, thc, 3);
+	inptSrc.setInptSt(0, true);
+	run(inptSrc, thc, 50);
+	chck(thc.getIsOn(), "Bounce: a glitch shorter than the debounce time doesn't drop the output");
+	chck(thc.getCyclsCnt() == 1, "Bounce: one cycle counted");
+
+	return;
+}
+
+static void tstPwrUpHld(){
+	MpbSwInptSrc inptSrc(2);
+	TwoHndMPBttn thc(gpioPinId_t{NULL, _InvalidPinNum}, gpioPinId_t{NULL, _InvalidPinNum});
+
+	thc.setChnlsInptSrc(&inptSrc, 0, 1);
+	chck(thc.getTwoHndStt() == TwoHndMPBttn::thBlckd, "Power-up: blocked before the first update");
+	setChnls(inptSrc, true, true);	//Both channels held, bridged or stuck since power-up
+	run(inptSrc, thc, 200);
+	chck(!thc.getIsOn(), "Power-up: channels held at power-up don't set the output");
+	chck(thc.getTwoHndStt() == TwoHndMPBttn::thBlckd, "Power-up: blocked while the channels are held");
+	chck(thc.getCyclsCnt() == 0, "Power-up: no cycle counted");
+	setChnls(inptSrc, false, false);
+	run(inptSrc, thc, 50);
+	chck(thc.getTwoHndStt() == TwoHndMPBttn::thArmd, "Power-up: armed after both channels are released");
+	setChnls(inptSrc, true, true);
+	run(inptSrc, thc, 100);
+	chck(thc.getIsOn(), "Power-up: new cycle sets the output");
+	chck(thc.getCyclsCnt() == 1, "Power-up: one cycle counted");
+
+	return;
+}
+
+int main(){
+	tstSmltnsPrss();
+	tstLtPrssBlcks();
+	tstRlsDrpsOtpt();
+	tstRarm();
+	tstBnc();
+	tstPwrUpHld();
+	if(fldChcks == 0)
+		printf("TwoHndMPBttn: all checks passed\n");
+	else
+		printf("TwoHndMPBttn: %lu checks failed\n", (unsigned long)fldChcks);
+
+	return (fldChcks == 0)?0:1;
+}
@@ -0,0 +1,49 @@
+/**
+  ******************************************************************************
+  * @file	: stm32f4xx_hal.cpp
+  * @brief	: Minimal STM32 HAL stand-in implementation for the host tests
+  *
+  * The GPIO ports are plain memory structures: the pins levels are read from the
+  * IDR register and written to the ODR register, so a test might drive the
+  * inputs by writing IDR bits.
+  *
+  ******************************************************************************
+  */
+#include "stm32f4xx_hal.h"
+
+GPIO_TypeDef hstGpioA {};
+GPIO_TypeDef hstGpioB {};
+GPIO_TypeDef hstGpioC {};
+
+void HAL_GPIO_Init(GPIO_TypeDef* GPIOx, GPIO_InitTypeDef* GPIO_Init){
+	(void)GPIOx;
+	(void)GPIO_Init;
+
+	return;
+}
+
+void HAL_GPIO_DeInit(GPIO_TypeDef* GPIOx, uint32_t GPIO_Pin){
+	(void)GPIOx;
+	(void)GPIO_Pin;
+
+	return;
+}
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin){
+
+	return ((GPIOx->IDR & GPIO_Pin) != 0)?GPIO_PIN_SET:GPIO_PIN_RESET;
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState){
+	if(PinState == GPIO_PIN_SET)
+		GPIOx->ODR |= GPIO_Pin;
+	else
+		GPIOx->ODR &= ~((uint32_t)GPIO_Pin);
+
+	return;
+}
+
+uint32_t HAL_GetTick(void){
+
+	return 0;
+}
@@ -0,0 +1,72 @@
+/**
+  ******************************************************************************
+  * @file	: stm32f4xx_hal.h
+  * @brief	: Minimal STM32 HAL stand-in for the ButtonToSwitch for STM32 library host tests
+  *
+  * Provides just the GPIO types, the GPIO services and the core intrinsics used
+  * by the library bare-metal build (MPB_BARE_METAL), so the library might be
+  * compiled and executed off-target. No other HAL module is enabled.
+  *
+  ******************************************************************************
+  */
+#ifndef __STM32F4xx_HAL_H
+#define __STM32F4xx_HAL_H
+
+#include <stdint.h>
+
+typedef struct {
+	volatile uint32_t MODER, OTYPER, OSPEEDR, PUPDR, IDR, ODR, BSRR, LCKR, AFR[2];
+} GPIO_TypeDef;
+
+extern GPIO_TypeDef hstGpioA, hstGpioB, hstGpioC;
+#define GPIOA (&hstGpioA)
+#define GPIOB (&hstGpioB)
+#define GPIOC (&hstGpioC)
+#define __HAL_RCC_GPIOA_CLK_ENABLE() do{}while(0)
+#define __HAL_RCC_GPIOB_CLK_ENABLE() do{}while(0)
+#define __HAL_RCC_GPIOC_CLK_ENABLE() do{}while(0)
+
+typedef enum {
+	GPIO_PIN_RESET = 0,
+	GPIO_PIN_SET
+} GPIO_PinState;
+
+typedef struct {
+	uint32_t Pin;
+	uint32_t Mode;
+	uint32_t Pull;
+	uint32_t Speed;
+	uint32_t Alternate;
+} GPIO_InitTypeDef;
+
+#define GPIO_MODE_INPUT 0x00000000U
+#define GPIO_MODE_OUTPUT_PP 0x00000001U
+#define GPIO_MODE_OUTPUT_OD 0x00000011U
+#define GPIO_MODE_IT_RISING_FALLING 0x10310000U
+#define GPIO_NOPULL 0x00000000U
+#define GPIO_PULLUP 0x00000001U
+#define GPIO_PULLDOWN 0x00000002U
+#define GPIO_SPEED_FREQ_LOW 0x00000000U
+
+typedef enum {
+	HAL_OK = 0x00U,
+	HAL_ERROR = 0x01U,
+	HAL_BUSY = 0x02U,
+	HAL_TIMEOUT = 0x03U
+} HAL_StatusTypeDef;
+
+void HAL_GPIO_Init(GPIO_TypeDef* GPIOx, GPIO_InitTypeDef* GPIO_Init);
+void HAL_GPIO_DeInit(GPIO_TypeDef* GPIOx, uint32_t GPIO_Pin);
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin);
+void HAL_GPIO_WritePin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+uint32_t HAL_GetTick(void);
+
+//Core intrinsics: the host executes no interrupts, the critical sections have nothing to mask
+static inline uint32_t __get_PRIMASK(void){return 0;}
+static inline void __set_PRIMASK(uint32_t priMask){(void)priMask;}
+static inline void __disable_irq(void){}
+static inline void __enable_irq(void){}
+static inline void __DMB(void){}
+static inline uint32_t __get_IPSR(void){return 0;}
+
+#endif /* __STM32F4xx_HAL_H */
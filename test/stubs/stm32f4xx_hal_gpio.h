@@ -0,0 +1,6 @@
+#ifndef __STM32F4xx_HAL_GPIO_H
+#define __STM32F4xx_HAL_GPIO_H
+
+#include "stm32f4xx_hal.h"	//The host stand-in declares the GPIO services in the main HAL header
+
+#endif /* __STM32F4xx_HAL_GPIO_H */